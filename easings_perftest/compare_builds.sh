@@ -0,0 +1,75 @@
+#!/bin/bash
+#NOTE: it has to be bash, sh won't do
+
+BUILDS="inline extern shared lto isa"  #Builds to compare, the first one is the reference for the diffs
+CFLAGS="-O2 -std=c99 -Wall -Wextra -pedantic"  #Compile flags of every build (the Makefile doesn't optimize)
+DEFINES=""  #Compile-time switches for every build (e.g. "-DEASINGS_FAST_MATH")
+NDPARAMS="--direct"  #Test program numerical options
+TSIZE="test_builds_size.txt"  #Output file for the sizes of every build
+SAMPLING="--warmup=2 --samples=50 --rel-err=0.01"  #Test program sampling options (repetitions of each timing)
+
+#inline: easings.h functions are static inline in the test program (the default)
+#extern: the test program calls them in libeasings.a
+#shared: the test program calls them in libeasings.so, through the PLT
+#lto: like extern, but compiled with -flto=auto so the linker can inline them again
+#isa: like shared, with libeasings_isa.so (batch functions for each ISA level, also timed one by one)
+build_perftest () {
+	case $1 in
+	inline)
+		gcc $CFLAGS $DEFINES -o easings_perftest_inline easings_perftest.c -lm -pthread
+		;;
+	extern)
+		make -B libeasings.a LIBFLAGS="-O2" DEFINES="$DEFINES"
+		gcc $CFLAGS $DEFINES -DEASINGS_EXTERN -o easings_perftest_extern easings_perftest.c \
+		    libeasings.a -lm -pthread
+		;;
+	shared)
+		make -B libeasings.so LIBFLAGS="-O2" DEFINES="$DEFINES"
+		gcc $CFLAGS $DEFINES -DEASINGS_EXTERN -o easings_perftest_shared easings_perftest.c \
+		    -L. -leasings -Wl,-rpath,'$ORIGIN' -lm -pthread
+		;;
+	lto)
+		gcc $CFLAGS $DEFINES -flto=auto -c -o easings_lto.o easings.c
+		gcc $CFLAGS $DEFINES -flto=auto -DEASINGS_EXTERN -o easings_perftest_lto easings_perftest.c \
+		    easings_lto.o -lm -pthread
+		;;
+	isa)
+		make -B easings_perftest_isa DEFINES="$DEFINES"
+		;;
+	esac
+}
+
+#Sizes: text/data/bss of the program (plus the library for the shared build), and the bytes of
+#the out of line easings functions, a lower bound of the code fetched into the instruction cache
+#by the easings (inlined copies are part of the callers' text)
+: > $TSIZE
+for build in $BUILDS
+do
+	build_perftest $build
+	files="easings_perftest_$build"
+	if [ $build = "shared" ]; then
+		files="$files libeasings.so"
+	elif [ $build = "isa" ]; then
+		files="$files libeasings_isa.so"
+	fi
+	echo "$build:" >> $TSIZE
+	size $files >> $TSIZE
+	nm -S -t d $files | awk '$4 ~ /^Ease/ { n++; bytes += $2 }
+		END { printf "%d easings functions out of line, %d bytes\n\n", n, bytes }' >> $TSIZE
+done
+cat $TSIZE
+
+for build in $BUILDS
+do
+	./easings_perftest_$build --out=test_build_$build.txt $NDPARAMS $SAMPLING
+done
+
+ref=""
+for build in $BUILDS
+do
+	if [ -z "$ref" ]; then
+		ref=$build
+	else
+		diff -y -t test_build_$ref.txt test_build_$build.txt > test_build_diff_$build.txt
+	fi
+done
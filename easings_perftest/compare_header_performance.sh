@@ -7,23 +7,15 @@ T1OUT="test_orig.txt"  #Output file for the results of the test using the origin
 T2OUT="test_newh.txt"  #Output file for the results of the test using the modified header
 TDIFF="test_diff.txt"  #Output file for the diff file
 NDPARAMS=""  #Test program numerical options
-TESTITR=8  #Number of consecutive times the performance testing program is run
+ORIGDEFS=""  #Compile-time switches for the original header build
+MODFDEFS=""  #Compile-time switches for the modified header build (e.g. "-DEASINGS_FAST_EXP2")
+SAMPLING="--warmup=2 --samples=50 --rel-err=0.01"  #Test program sampling options (repetitions of each timing)
 
 cp -v $ORIGHDR easings.h
-make
-iter=0
-while [ $iter -lt $TESTITR ]
-do
-	./easings_perftest --out=$T1OUT $NDPARAMS
-	((iter++))
-done
+make DEFINES="$ORIGDEFS"
+./easings_perftest --out=$T1OUT $NDPARAMS $SAMPLING
 cp -v $MODFHDR easings.h
 
-make
-iter=0
-while [ $iter -lt $TESTITR ]
-do
-	./easings_perftest --out=$T2OUT $NDPARAMS
-	((iter++))
-done
+make DEFINES="$MODFDEFS"
+./easings_perftest --out=$T2OUT $NDPARAMS $SAMPLING
 diff -y -t $T1OUT $T2OUT > $TDIFF
@@ -0,0 +1,32 @@
+/**********************************************************************************************
+*   easings.c
+*
+*   Compiles the functions in raylib easings.h once, for the static and shared library targets
+*   of the Makefile. Programs linked with the library include easings.h with EASINGS_EXTERN
+*   defined, so they only get the declarations.
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2019 Juan Miguel López
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+
+#define EASINGS_IMPLEMENTATION
+#include "easings.h"
@@ -0,0 +1,397 @@
+/*******************************************************************************************
+*
+*   raylib easings C++ front end (header only file)
+*
+*   constexpr versions of the easings.h normalized curves, specialized per easing type at
+*   compile time, so a curve can be fully inlined and whole tables can be baked by the compiler.
+*
+*   This header uses:
+*       C++17 (if constexpr, inline variables). easings.h is included for EaseType and the
+*       EASINGS_FAST_* polynomial coefficients.
+*
+*   How to use:
+*   ease<K>(u) maps normalized time u = t/d to the curve like EaseXxxU(u), ease<K>(t, b, c, d)
+*   is the Penner form and ease(k, u) picks the curve at runtime with a switch.
+*
+*   float x = easings::ease<easings::Ease::ElasticOut>(t, startX, finalX - startX, duration);
+*
+*   constexpr float half = easings::ease<easings::Ease::QuadIn>(0.5f);          // 0.25f, no code
+*   constexpr auto &table = easings::table<easings::Ease::BounceOut, 256>;      // In .rodata
+*
+*   NOTE: sinf(), cosf() and powf(2.0f, x) have no constexpr form, so constant evaluation uses the
+*   EaseFastSinf()/EaseFastCosf()/EaseFastExp2f() polynomials of easings.h (same results as a C build
+*   with EASINGS_FAST_MATH) and a Newton iteration for sqrtf() (correctly rounded). At runtime the
+*   same EASINGS_SINF/EASINGS_COSF/EASINGS_EXP2F and sqrtf() as easings.h are called, when the
+*   compiler can tell both apart (GCC 9+, Clang 9+, MSVC 19.25+ or any C++20 compiler).
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2019 Juan Miguel López
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef EASINGS_HPP
+#define EASINGS_HPP
+
+#include "easings.h"
+
+#include <array>        // Required for: std::array
+#include <cstddef>      // Required for: std::size_t
+#include <limits>       // Required for: std::numeric_limits
+
+#if defined(__cpp_lib_is_constant_evaluated)
+    #include <type_traits>
+    #define EASINGS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif (defined(__GNUC__) && (__GNUC__ >= 9)) || defined(__clang__) || (defined(_MSC_VER) && (_MSC_VER >= 1925))
+    #define EASINGS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+    #define EASINGS_CONSTANT_EVALUATED() true   // NOTE: Always use the constexpr math
+#endif
+
+namespace easings {
+
+// Easing types, in the same order (and with the same values) as EaseType
+enum class Ease : int {
+    LinearNone = EASE_TYPE_LINEAR_NONE,
+    LinearIn = EASE_TYPE_LINEAR_IN,
+    LinearOut = EASE_TYPE_LINEAR_OUT,
+    LinearInOut = EASE_TYPE_LINEAR_IN_OUT,
+    SineIn = EASE_TYPE_SINE_IN,
+    SineOut = EASE_TYPE_SINE_OUT,
+    SineInOut = EASE_TYPE_SINE_IN_OUT,
+    CircIn = EASE_TYPE_CIRC_IN,
+    CircOut = EASE_TYPE_CIRC_OUT,
+    CircInOut = EASE_TYPE_CIRC_IN_OUT,
+    CubicIn = EASE_TYPE_CUBIC_IN,
+    CubicOut = EASE_TYPE_CUBIC_OUT,
+    CubicInOut = EASE_TYPE_CUBIC_IN_OUT,
+    QuadIn = EASE_TYPE_QUAD_IN,
+    QuadOut = EASE_TYPE_QUAD_OUT,
+    QuadInOut = EASE_TYPE_QUAD_IN_OUT,
+    ExpoIn = EASE_TYPE_EXPO_IN,
+    ExpoOut = EASE_TYPE_EXPO_OUT,
+    ExpoInOut = EASE_TYPE_EXPO_IN_OUT,
+    BackIn = EASE_TYPE_BACK_IN,
+    BackOut = EASE_TYPE_BACK_OUT,
+    BackInOut = EASE_TYPE_BACK_IN_OUT,
+    BounceOut = EASE_TYPE_BOUNCE_OUT,
+    BounceIn = EASE_TYPE_BOUNCE_IN,
+    BounceInOut = EASE_TYPE_BOUNCE_IN_OUT,
+    ElasticIn = EASE_TYPE_ELASTIC_IN,
+    ElasticOut = EASE_TYPE_ELASTIC_OUT,
+    ElasticInOut = EASE_TYPE_ELASTIC_IN_OUT,
+    Count = EASE_TYPE_COUNT
+};
+
+//----------------------------------------------------------------------------------
+// constexpr math functions
+// NOTE: Same steps as EaseFastSinCosf() and EaseFastExp2f(), without the bit casts
+//----------------------------------------------------------------------------------
+namespace detail {
+
+constexpr float copysign(float x, float y) { return (y < 0.0f)? -x : x; }
+
+// Computes sin(x) for quadrant 0 and cos(x) for quadrant 1, |x| must be under 2^30
+constexpr float sincos(float x, int quadrant)
+{
+    float y = x*(2.0f/PI);
+
+    int j = (int)(y + copysign(0.5f, y));
+    float r = x - (float)j*EASINGS_FAST_PIO2_1;
+    r -= (float)j*EASINGS_FAST_PIO2_2;
+    r -= (float)j*EASINGS_FAST_PIO2_3;
+
+    float z = r*r;
+    float ps = ((EASINGS_FAST_SIN_C7*z + EASINGS_FAST_SIN_C5)*z + EASINGS_FAST_SIN_C3)*z*r + r;
+    float pc = ((EASINGS_FAST_COS_C8*z + EASINGS_FAST_COS_C6)*z + EASINGS_FAST_COS_C4)*z*z - 0.5f*z + 1.0f;
+
+    int q = j + quadrant;
+    float k = (float)(q & 1);
+    float sign = (float)(1 - (q & 2));
+
+    return (ps*(1.0f - k) + pc*k)*sign;
+}
+
+// Computes 2^x, results under 2^-127 are flushed to 0.0f, |x| must be under 2^30
+constexpr float exp2poly(float x)
+{
+    int n = (int)(x + copysign(0.5f, x));
+    float f = x - (float)n;
+    float p = (((((EASINGS_FAST_EXP2_C6*f + EASINGS_FAST_EXP2_C5)*f + EASINGS_FAST_EXP2_C4)*f +
+                EASINGS_FAST_EXP2_C3)*f + EASINGS_FAST_EXP2_C2)*f + EASINGS_FAST_EXP2_C1)*f + 1.0f;
+
+    // NOTE: 2^n is built by exact multiplications, matching the exponent bits of EaseFastExp2f()
+    if (n <= -127) return 0.0f;
+    if (n >= 128) return p*std::numeric_limits<float>::infinity();
+
+    float scale = 1.0f;
+    for (; n > 0; n--) scale *= 2.0f;
+    for (; n < 0; n++) scale *= 0.5f;
+
+    return p*scale;
+}
+
+// Computes sqrt(x) with Newton steps in double, rounded once to float
+constexpr float sqrtnewton(float x)
+{
+    if (!(x > 0.0f)) return (x == 0.0f)? x : std::numeric_limits<float>::quiet_NaN();
+    if (x == std::numeric_limits<float>::infinity()) return x;
+
+    double v = x;
+    double r = (v > 1.0)? v : 1.0;
+    for (double prev = 0.0; r != prev; )
+    {
+        prev = r;
+        r = 0.5*(r + v/r);
+        if (r >= prev) break;   // Converged from above, stop before it cycles
+    }
+
+    return (float)r;
+}
+
+// NOTE: Not named sinf() and so on, EASINGS_SINF() and friends expand to unqualified libm calls
+constexpr float sin(float x) { return EASINGS_CONSTANT_EVALUATED()? sincos(x, 0) : EASINGS_SINF(x); }
+constexpr float cos(float x) { return EASINGS_CONSTANT_EVALUATED()? sincos(x, 1) : EASINGS_COSF(x); }
+constexpr float exp2(float x) { return EASINGS_CONSTANT_EVALUATED()? exp2poly(x) : EASINGS_EXP2F(x); }
+constexpr float sqrt(float x) { return EASINGS_CONSTANT_EVALUATED()? sqrtnewton(x) : sqrtf(x); }
+
+} // namespace detail
+
+//----------------------------------------------------------------------------------
+// Normalized Easing functions
+// NOTE: Same expressions as the EaseXxxU() curves of easings.h
+//----------------------------------------------------------------------------------
+template<Ease K>
+constexpr float ease(float u)
+{
+    static_assert((K >= Ease::LinearNone) && (K < Ease::Count), "Unknown easing type");
+
+    if constexpr ((K == Ease::LinearNone) || (K == Ease::LinearIn) || (K == Ease::LinearOut) || (K == Ease::LinearInOut))
+    {
+        return u;
+    }
+    else if constexpr (K == Ease::SineIn) return (1.0f - detail::cos(u*(PI/2.0f)));
+    else if constexpr (K == Ease::SineOut) return detail::sin(u*(PI/2.0f));
+    else if constexpr (K == Ease::SineInOut) return (-0.5f*(detail::cos(PI*u) - 1.0f));
+    else if constexpr (K == Ease::CircIn) return (1.0f - detail::sqrt(1.0f - u*u));
+    else if constexpr (K == Ease::CircOut)
+    {
+        u -= 1.0f;
+        return detail::sqrt(1.0f - u*u);
+    }
+    else if constexpr (K == Ease::CircInOut)
+    {
+        if ((u*=2.0f) < 1.0f) return (-0.5f*(detail::sqrt(1.0f - u*u) - 1.0f));
+        u -= 2.0f; return (0.5f*(detail::sqrt(1.0f - u*u) + 1.0f));
+    }
+    else if constexpr (K == Ease::CubicIn) return (u*u*u);
+    else if constexpr (K == Ease::CubicOut)
+    {
+        u -= 1.0f;
+        return (u*u*u + 1.0f);
+    }
+    else if constexpr (K == Ease::CubicInOut)
+    {
+        if ((u*=2.0f) < 1.0f) return (0.5f*u*u*u);
+        u -= 2.0f; return (0.5f*(u*u*u + 2.0f));
+    }
+    else if constexpr (K == Ease::QuadIn) return (u*u);
+    else if constexpr (K == Ease::QuadOut) return (-u*(u - 2.0f));
+    else if constexpr (K == Ease::QuadInOut)
+    {
+        if ((u*=2.0f) < 1.0f) return (0.5f*(u*u));
+        return (-0.5f*(((u - 1.0f)*(u - 3.0f)) - 1.0f));
+    }
+    else if constexpr (K == Ease::ExpoIn) return (u == 0.0f)? 0.0f : detail::exp2(10.0f*(u - 1.0f));
+    else if constexpr (K == Ease::ExpoOut) return (u == 1.0f)? 1.0f : (-detail::exp2(-10.0f*u) + 1.0f);
+    else if constexpr (K == Ease::ExpoInOut)
+    {
+        if (u == 0.0f) return 0.0f;
+        if (u == 1.0f) return 1.0f;
+        if ((u*=2.0f) < 1.0f) return (0.5f*detail::exp2(10.0f*(u - 1.0f)));
+
+        return (0.5f*(-detail::exp2(-10.0f*(u - 1.0f)) + 2.0f));
+    }
+    else if constexpr (K == Ease::BackIn)
+    {
+        float s = 1.70158f;
+        return (u*u*((s + 1.0f)*u - s));
+    }
+    else if constexpr (K == Ease::BackOut)
+    {
+        float s = 1.70158f;
+        u -= 1.0f;
+        return (u*u*((s + 1.0f)*u + s) + 1.0f);
+    }
+    else if constexpr (K == Ease::BackInOut)
+    {
+        float s = 1.70158f*1.525f;
+        if ((u*=2.0f) < 1.0f) return (0.5f*(u*u*((s + 1.0f)*u - s)));
+
+        u -= 2.0f;
+        return (0.5f*(u*u*((s + 1.0f)*u + s) + 2.0f));
+    }
+    else if constexpr (K == Ease::BounceOut)
+    {
+        if (u < (1.0f/2.75f))
+        {
+            return (7.5625f*u*u);
+        }
+        else if (u < (2.0f/2.75f))
+        {
+            u -= (1.5f/2.75f);
+            return (7.5625f*u*u + 0.75f);
+        }
+        else if (u < (2.5/2.75))
+        {
+            u -= (2.25f/2.75f);
+            return (7.5625f*u*u + 0.9375f);
+        }
+        else
+        {
+            u -= (2.625f/2.75f);
+            return (7.5625f*u*u + 0.984375f);
+        }
+    }
+    else if constexpr (K == Ease::BounceIn) return (1.0f - ease<Ease::BounceOut>(1.0f - u));
+    else if constexpr (K == Ease::BounceInOut)
+    {
+        if (u < 0.5f) return (ease<Ease::BounceIn>(u*2.0f)*0.5f);
+        else return (ease<Ease::BounceOut>(u*2.0f - 1.0f)*0.5f + 0.5f);
+    }
+    else if constexpr (K == Ease::ElasticIn)
+    {
+        if (u == 0.0f) return 0.0f;
+        if (u == 1.0f) return 1.0f;
+
+        float p = 0.3f;
+        float s = p/4.0f;
+        u -= 1.0f;
+
+        return (-(detail::exp2(10.0f*u)*detail::sin((u - s)*(2.0f*PI)/p)));
+    }
+    else if constexpr (K == Ease::ElasticOut)
+    {
+        if (u == 0.0f) return 0.0f;
+        if (u == 1.0f) return 1.0f;
+
+        float p = 0.3f;
+        float s = p/4.0f;
+
+        return (detail::exp2(-10.0f*u)*detail::sin((u - s)*(2.0f*PI)/p) + 1.0f);
+    }
+    else
+    {
+        if (u == 0.0f) return 0.0f;
+        if ((u*=2.0f) == 2.0f) return 1.0f;
+
+        float p = 0.3f*1.5f;
+        float s = p/4.0f;
+
+        if (u < 1.0f)
+        {
+            u -= 1.0f;
+            return -0.5f*(detail::exp2(10.0f*u)*detail::sin((u - s)*(2.0f*PI)/p));
+        }
+
+        u -= 1.0f;
+
+        return (detail::exp2(-10.0f*u)*detail::sin((u - s)*(2.0f*PI)/p)*0.5f + 1.0f);
+    }
+}
+
+// Penner form, c*ease<K>(t/d) + b
+template<Ease K>
+constexpr float ease(float t, float b, float c, float d) { return (c*ease<K>(t/d) + b); }
+
+// Picks the curve at runtime, the switch cases are the specialized ease<K>()
+// NOTE: Unknown types return 0.0f, like EaseCurveU()
+constexpr float ease(Ease k, float u)
+{
+    switch (k)
+    {
+        case Ease::LinearNone: return ease<Ease::LinearNone>(u);
+        case Ease::LinearIn: return ease<Ease::LinearIn>(u);
+        case Ease::LinearOut: return ease<Ease::LinearOut>(u);
+        case Ease::LinearInOut: return ease<Ease::LinearInOut>(u);
+        case Ease::SineIn: return ease<Ease::SineIn>(u);
+        case Ease::SineOut: return ease<Ease::SineOut>(u);
+        case Ease::SineInOut: return ease<Ease::SineInOut>(u);
+        case Ease::CircIn: return ease<Ease::CircIn>(u);
+        case Ease::CircOut: return ease<Ease::CircOut>(u);
+        case Ease::CircInOut: return ease<Ease::CircInOut>(u);
+        case Ease::CubicIn: return ease<Ease::CubicIn>(u);
+        case Ease::CubicOut: return ease<Ease::CubicOut>(u);
+        case Ease::CubicInOut: return ease<Ease::CubicInOut>(u);
+        case Ease::QuadIn: return ease<Ease::QuadIn>(u);
+        case Ease::QuadOut: return ease<Ease::QuadOut>(u);
+        case Ease::QuadInOut: return ease<Ease::QuadInOut>(u);
+        case Ease::ExpoIn: return ease<Ease::ExpoIn>(u);
+        case Ease::ExpoOut: return ease<Ease::ExpoOut>(u);
+        case Ease::ExpoInOut: return ease<Ease::ExpoInOut>(u);
+        case Ease::BackIn: return ease<Ease::BackIn>(u);
+        case Ease::BackOut: return ease<Ease::BackOut>(u);
+        case Ease::BackInOut: return ease<Ease::BackInOut>(u);
+        case Ease::BounceOut: return ease<Ease::BounceOut>(u);
+        case Ease::BounceIn: return ease<Ease::BounceIn>(u);
+        case Ease::BounceInOut: return ease<Ease::BounceInOut>(u);
+        case Ease::ElasticIn: return ease<Ease::ElasticIn>(u);
+        case Ease::ElasticOut: return ease<Ease::ElasticOut>(u);
+        case Ease::ElasticInOut: return ease<Ease::ElasticInOut>(u);
+        default: return 0.0f;
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Compile-time Easing tables
+// NOTE: N + 1 samples of ease<K>() at u = i/N, end points included, built by the compiler so
+// there is no startup cost (unlike EaseTableGet()). Keep N in the low thousands, compilers
+// limit the number of constexpr evaluation steps
+//----------------------------------------------------------------------------------
+template<Ease K, std::size_t N>
+constexpr std::array<float, N + 1> make_table()
+{
+    static_assert(N >= 1, "Easing tables need at least two samples");
+
+    std::array<float, N + 1> samples{};
+    for (std::size_t i = 0; i <= N; i++) samples[i] = ease<K>((float)i/(float)N);
+
+    return samples;
+}
+
+template<Ease K, std::size_t N>
+inline constexpr std::array<float, N + 1> table = make_table<K, N>();
+
+// Linear interpolation in table<K, N>, u is clamped to [0, 1]
+template<Ease K, std::size_t N>
+constexpr float ease_table(float u)
+{
+    if (!(u > 0.0f)) return table<K, N>[0];
+    if (u >= 1.0f) return table<K, N>[N];
+
+    float x = u*(float)N;
+    std::size_t i = (std::size_t)x;
+    if (i >= N) i = N - 1;
+    float f = x - (float)i;
+
+    return (table<K, N>[i] + (table<K, N>[i + 1] - table<K, N>[i])*f);
+}
+
+} // namespace easings
+
+#endif // EASINGS_HPP
@@ -0,0 +1,77 @@
+/**********************************************************************************************
+*
+*   easings_hpp_test.cpp
+*
+*   Program used to check that easings.hpp builds as C++17 and gives the same curves as easings.h
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2019 Juan Miguel López
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include "easings.hpp"
+
+#include <cstdio>       // Required for: std::printf(), std::fprintf()
+#include <cstdlib>      // Required for: EXIT_SUCCESS, EXIT_FAILURE
+
+using easings::Ease;
+
+// NOTE: Values exactly representable as float, so constant evaluation has to give them exactly
+static_assert(easings::ease<Ease::LinearNone>(0.3f) == 0.3f, "LinearNone");
+static_assert(easings::ease<Ease::QuadIn>(0.5f) == 0.25f, "QuadIn");
+static_assert(easings::ease<Ease::QuadOut>(0.5f) == 0.75f, "QuadOut");
+static_assert(easings::ease<Ease::CubicIn>(0.5f) == 0.125f, "CubicIn");
+static_assert(easings::ease<Ease::CircOut>(1.0f) == 1.0f, "CircOut");
+static_assert(easings::ease<Ease::ExpoIn>(0.0f) == 0.0f, "ExpoIn");
+static_assert(easings::ease<Ease::ElasticOut>(1.0f) == 1.0f, "ElasticOut");
+static_assert(easings::ease<Ease::QuadIn>(300.0f, 0.0f, 2000.0f, 600.0f) == 500.0f, "QuadIn Penner form");
+static_assert(easings::ease(Ease::CubicIn, 0.5f) == 0.125f, "Runtime switch");
+static_assert(easings::table<Ease::QuadIn, 4>[2] == 0.25f, "QuadIn table");
+static_assert(easings::table<Ease::CubicIn, 4>[4] == 1.0f, "CubicIn table end");
+static_assert(easings::ease_table<Ease::QuadIn, 4>(0.5f) == 0.25f, "QuadIn table lookup");
+
+#define CHECK_SAMPLES 10000     // Samples of each curve, u = i/CHECK_SAMPLES
+
+int main(void)
+{
+    long mismatches = 0;
+
+    // The runtime curves call the same math functions as easings.h, so they have to match exactly
+    for (int type = 0; type < EASE_TYPE_COUNT; type++)
+    {
+        for (int i = 0; i <= CHECK_SAMPLES; i++)
+        {
+            float u = (float)i/(float)CHECK_SAMPLES;
+            float hpp = easings::ease((Ease)type, u);
+            float h = EaseCurveU((EaseType)type, u);
+
+            if (hpp != h)
+            {
+                if (mismatches < 10) std::fprintf(stderr, "Type %d at u = %.9g: easings.hpp %.9g, easings.h %.9g\n", type, u, hpp, h);
+                mismatches++;
+            }
+        }
+    }
+
+    std::printf("easings.hpp: %ld of %d curve values differ from EaseCurveU()\n", mismatches,
+                EASE_TYPE_COUNT*(CHECK_SAMPLES + 1));
+
+    return (mismatches == 0)? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,178 @@
+/**********************************************************************************************
+*   easings_isa.c
+*
+*   Compiles the functions in raylib easings.h once, for the libeasings_isa.so target of the
+*   Makefile, with the batch functions compiled for every x86-64 ISA level and picked by ifunc
+*   resolvers when the library is loaded (see easings_isa.h).
+*
+*   NOTE: Built with -fno-semantic-interposition, or the scalar functions called by the batch
+*   loops could be replaced by other libraries and would not be inlined (nor vectorized).
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2019 Juan Miguel López
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+
+#include <stddef.h>
+
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__ELF__)
+	#define EASINGS_ISA_X86
+#endif
+
+#if defined(EASINGS_ISA_X86)
+
+typedef void (*ResolvedN)(const float *, float *, size_t, float, float, float);
+typedef void (*ResolvedNV)(const float *, float *, size_t, const float *, const float *,
+                           const float *);
+
+static int cpu_level(void);
+
+// Batch functions of func for one ISA level, func is inlined and compiled for it
+#define ISA_BATCH(func, level, target) \
+	target static void func##N_##level(const float *EASINGS_RESTRICT t, \
+	                                   float *EASINGS_RESTRICT out, size_t n, \
+	                                   float b, float c, float d) \
+	{ \
+		for (size_t i = 0; i < n; i++) out[i] = func(t[i], b, c, d); \
+	} \
+	target static void func##NV_##level(const float *EASINGS_RESTRICT t, \
+	                                    float *EASINGS_RESTRICT out, size_t n, \
+	                                    const float *EASINGS_RESTRICT b, \
+	                                    const float *EASINGS_RESTRICT c, \
+	                                    const float *EASINGS_RESTRICT d) \
+	{ \
+		for (size_t i = 0; i < n; i++) out[i] = func(t[i], b[i], c[i], d[i]); \
+	}
+
+// NOTE: Replaces the easings.h definition, every batch function is an ifunc resolved to one
+// of its four versions
+#define EASINGS_BATCH_DEFINE(func) \
+	ISA_BATCH(func, base, ) \
+	ISA_BATCH(func, v2, __attribute__((target("arch=x86-64-v2")))) \
+	ISA_BATCH(func, v3, __attribute__((target("arch=x86-64-v3")))) \
+	ISA_BATCH(func, v4, __attribute__((target("arch=x86-64-v4")))) \
+	static ResolvedN func##N_resolve(void) \
+	{ \
+		static const ResolvedN versions[] = { \
+			func##N_base, func##N_v2, func##N_v3, func##N_v4 \
+		}; \
+		return versions[cpu_level()]; \
+	} \
+	static ResolvedNV func##NV_resolve(void) \
+	{ \
+		static const ResolvedNV versions[] = { \
+			func##NV_base, func##NV_v2, func##NV_v3, func##NV_v4 \
+		}; \
+		return versions[cpu_level()]; \
+	} \
+	EASEDEF void func##N(const float *EASINGS_RESTRICT t, float *EASINGS_RESTRICT out, \
+	                     size_t n, float b, float c, float d) \
+	                     __attribute__((ifunc(#func "N_resolve"))); \
+	EASEDEF void func##NV(const float *EASINGS_RESTRICT t, float *EASINGS_RESTRICT out, \
+	                      size_t n, const float *EASINGS_RESTRICT b, \
+	                      const float *EASINGS_RESTRICT c, const float *EASINGS_RESTRICT d) \
+	                      __attribute__((ifunc(#func "NV_resolve")));
+
+// Versions of an easing for EaseIsaGetBatch()
+#define ISA_VERSIONS(func) { func##N_base, func##N_v2, func##N_v3, func##N_v4 }
+
+#else
+
+#define ISA_VERSIONS(func) { func##N, NULL, NULL, NULL }
+
+#endif
+
+#define EASINGS_IMPLEMENTATION
+#include "easings_isa.h"
+
+
+static const EaseIsaBatchFunc isa_versions[EASE_TYPE_COUNT][EASE_ISA_COUNT] = {
+	ISA_VERSIONS(EaseLinearNone),
+	ISA_VERSIONS(EaseLinearIn),
+	ISA_VERSIONS(EaseLinearOut),
+	ISA_VERSIONS(EaseLinearInOut),
+	ISA_VERSIONS(EaseSineIn),
+	ISA_VERSIONS(EaseSineOut),
+	ISA_VERSIONS(EaseSineInOut),
+	ISA_VERSIONS(EaseCircIn),
+	ISA_VERSIONS(EaseCircOut),
+	ISA_VERSIONS(EaseCircInOut),
+	ISA_VERSIONS(EaseCubicIn),
+	ISA_VERSIONS(EaseCubicOut),
+	ISA_VERSIONS(EaseCubicInOut),
+	ISA_VERSIONS(EaseQuadIn),
+	ISA_VERSIONS(EaseQuadOut),
+	ISA_VERSIONS(EaseQuadInOut),
+	ISA_VERSIONS(EaseExpoIn),
+	ISA_VERSIONS(EaseExpoOut),
+	ISA_VERSIONS(EaseExpoInOut),
+	ISA_VERSIONS(EaseBackIn),
+	ISA_VERSIONS(EaseBackOut),
+	ISA_VERSIONS(EaseBackInOut),
+	ISA_VERSIONS(EaseBounceOut),
+	ISA_VERSIONS(EaseBounceIn),
+	ISA_VERSIONS(EaseBounceInOut),
+	ISA_VERSIONS(EaseElasticIn),
+	ISA_VERSIONS(EaseElasticOut),
+	ISA_VERSIONS(EaseElasticInOut),
+};
+
+#if defined(EASINGS_ISA_X86)
+// Get the widest level supported by the running CPU
+// NOTE: Called by the ifunc resolvers, while the library is being relocated, so it only
+// uses the compiler builtins (__builtin_cpu_init() has to be called first there)
+static int cpu_level(void)
+{
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("x86-64-v4")) return EASE_ISA_X86_64_V4;
+	if (__builtin_cpu_supports("x86-64-v3")) return EASE_ISA_X86_64_V3;
+	if (__builtin_cpu_supports("x86-64-v2")) return EASE_ISA_X86_64_V2;
+
+	return EASE_ISA_BASELINE;
+}
+#endif
+
+EaseIsaLevel EaseIsaDetect(void)
+{
+#if defined(EASINGS_ISA_X86)
+	return (EaseIsaLevel) cpu_level();
+#else
+	return EASE_ISA_BASELINE;
+#endif
+}
+
+const char *EaseIsaLevelName(EaseIsaLevel level)
+{
+	static const char *names[EASE_ISA_COUNT] = {
+		"x86-64", "x86-64-v2", "x86-64-v3", "x86-64-v4"
+	};
+
+	return ((unsigned) level < EASE_ISA_COUNT)? names[level] : "unknown";
+}
+
+EaseIsaBatchFunc EaseIsaGetBatch(EaseType type, EaseIsaLevel level)
+{
+	if ((unsigned) type >= EASE_TYPE_COUNT || (unsigned) level >= EASE_ISA_COUNT) return NULL;
+	if (level > EaseIsaDetect()) return NULL;
+
+	return isa_versions[type][level];
+}
@@ -0,0 +1,79 @@
+/*******************************************************************************************
+*
+*   easings ISA levels (shared library API)
+*
+*   libeasings_isa.so is easings.h built as a shared library (easings_isa.c) with the batch
+*   functions, EaseXxxN() and EaseXxxNV(), compiled once per x86-64 ISA level: the baseline
+*   (SSE2), x86-64-v2 (SSE4.2), x86-64-v3 (AVX2, FMA) and x86-64-v4 (AVX-512). Each of them is
+*   an ifunc, the dynamic linker resolves it to the widest version the CPU supports when the
+*   library is loaded, so calls go straight to that version without any per-call dispatch.
+*   This header gives access to every version, to time or check all of them on one machine.
+*
+*   How to use:
+*   Define EASINGS_EXTERN, include easings.h and then this file, and link with
+*   libeasings_isa.so (see the Makefile). The batch functions are called as usual.
+*
+*   float t[256], x[256];
+*   EaseElasticOutN(t, x, 256, startX, finalX - startX, duration);     // Widest version
+*   EaseIsaGetBatch(EASE_TYPE_ELASTIC_OUT, EASE_ISA_X86_64_V2)(t, x, 256, startX, finalX - startX, duration);
+*
+*   NOTE: All versions give the same results bit for bit, as the library is compiled with
+*   floating-point contraction off (-std=c99), so x86-64-v3 and v4 don't fuse into FMAs.
+*   On other architectures or compilers there is only the baseline version.
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2019 Juan Miguel López
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef EASINGS_ISA_H
+#define EASINGS_ISA_H
+
+#include "easings.h"
+
+#define EASINGS_HAS_ISA
+
+typedef void (*EaseIsaBatchFunc)(const float *t, float *out, size_t n, float b, float c, float d);
+
+// ISA levels, from narrowest to widest
+typedef enum {
+    EASE_ISA_BASELINE = 0,  // x86-64 (SSE2), the only level on other targets
+    EASE_ISA_X86_64_V2,     // SSE4.2, POPCNT
+    EASE_ISA_X86_64_V3,     // AVX2, FMA, BMI2
+    EASE_ISA_X86_64_V4,     // AVX-512F, BW, DQ, VL
+    EASE_ISA_COUNT
+} EaseIsaLevel;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Get the widest level supported by the running CPU (and OS), the one the batch functions use
+extern EaseIsaLevel EaseIsaDetect(void);
+
+extern const char *EaseIsaLevelName(EaseIsaLevel level);
+
+// Get the batch function of an easing compiled for a given level, NULL if the CPU does not support it
+extern EaseIsaBatchFunc EaseIsaGetBatch(EaseType type, EaseIsaLevel level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EASINGS_ISA_H
@@ -7,6 +7,16 @@
 *   This header uses:
 *       #define EASINGS_STATIC_INLINE       // Inlines all functions code, so it runs faster.
 *                                           // This requires lots of memory on system.
+*                                           // Default, unless one of the two below is defined
+*       #define EASINGS_IMPLEMENTATION      // Compiles the functions as extern, in ONE source file only
+*                                           // (a static or shared library, see easings_perftest Makefile)
+*       #define EASINGS_EXTERN              // Only declares the functions, to link with the file above
+*       #define EASINGS_FAST_MATH           // Use polynomial approximations instead of sinf(), cosf()
+*                                           // and powf() (see EaseFastSinf() for the error bounds)
+*       #define EASINGS_FAST_EXP2           // Only replace powf(2.0f, x) in Expo and Elastic easings,
+*                                           // already implied by EASINGS_FAST_MATH
+*       #define EASINGS_BRANCHLESS          // Use bit blends instead of branches inside the curves, so
+*                                           // batch loops vectorize and random inputs don't mispredict
 *   How to use:
 *   The four inputs t,b,c,d are defined as follows:
 *   t = current time (in any unit measure, but same unit as duration)
@@ -82,7 +92,10 @@
 #ifndef EASINGS_H
 #define EASINGS_H
 
-#define EASINGS_STATIC_INLINE     // NOTE: By default, compile functions as static inline
+// NOTE: By default, compile functions as static inline
+#if !defined(EASINGS_IMPLEMENTATION) && !defined(EASINGS_EXTERN)
+    #define EASINGS_STATIC_INLINE
+#endif
 
 #if defined(EASINGS_STATIC_INLINE)
     #define EASEDEF static inline
@@ -90,7 +103,17 @@
     #define EASEDEF extern
 #endif
 
-#include <math.h>       // Required for: sinf(), cosf(), sqrtf(), powf()
+#include <math.h>       // Required for: sinf(), cosf(), sqrtf(), powf(), asinf(), fabsf(), copysignf(), nextafterf()
+#include <stddef.h>     // Required for: size_t
+#include <stdint.h>     // Required for: uint32_t
+#include <stdlib.h>     // Required for: malloc(), free()
+#include <string.h>     // Required for: memcpy()
+
+#if defined(__cplusplus)
+    #define EASINGS_RESTRICT __restrict
+#else
+    #define EASINGS_RESTRICT restrict
+#endif
 
 #ifndef PI
     #define PI 3.14159265358979323846f //Required as PI is not always defined in math.h
@@ -99,165 +122,2240 @@
 #ifdef __cplusplus
 extern "C" {            // Prevents name mangling of functions
 #endif
+// Easing types, in the same order as the functions below
+// NOTE: Used to select an easing at runtime (tables, dispatch, prepared easings)
+typedef enum {
+    EASE_TYPE_LINEAR_NONE = 0,
+    EASE_TYPE_LINEAR_IN,
+    EASE_TYPE_LINEAR_OUT,
+    EASE_TYPE_LINEAR_IN_OUT,
+    EASE_TYPE_SINE_IN,
+    EASE_TYPE_SINE_OUT,
+    EASE_TYPE_SINE_IN_OUT,
+    EASE_TYPE_CIRC_IN,
+    EASE_TYPE_CIRC_OUT,
+    EASE_TYPE_CIRC_IN_OUT,
+    EASE_TYPE_CUBIC_IN,
+    EASE_TYPE_CUBIC_OUT,
+    EASE_TYPE_CUBIC_IN_OUT,
+    EASE_TYPE_QUAD_IN,
+    EASE_TYPE_QUAD_OUT,
+    EASE_TYPE_QUAD_IN_OUT,
+    EASE_TYPE_EXPO_IN,
+    EASE_TYPE_EXPO_OUT,
+    EASE_TYPE_EXPO_IN_OUT,
+    EASE_TYPE_BACK_IN,
+    EASE_TYPE_BACK_OUT,
+    EASE_TYPE_BACK_IN_OUT,
+    EASE_TYPE_BOUNCE_OUT,
+    EASE_TYPE_BOUNCE_IN,
+    EASE_TYPE_BOUNCE_IN_OUT,
+    EASE_TYPE_ELASTIC_IN,
+    EASE_TYPE_ELASTIC_OUT,
+    EASE_TYPE_ELASTIC_IN_OUT,
+    EASE_TYPE_COUNT
+} EaseType;
+
+// Fast math functions
+// NOTE: Polynomial replacements for sinf(), cosf() and powf(2.0f, x), used by the easings when
+// EASINGS_FAST_MATH is defined (only EaseFastExp2f() with EASINGS_FAST_EXP2). Maximum errors against
+// the exact result, checked by easings_results with --ulp, are EASINGS_FAST_SINCOS_ULP for |x| <= PI
+// (Sine easings), EASINGS_FAST_SINCOS_ULP_WIDE for |x| <= 64*PI (Elastic easings, the error grows
+// past it) and EASINGS_FAST_EXP2_ULP for x in [-126, 127] (Expo and Elastic easings only use [-10, 0]).
+// sqrtf() is kept: it is correctly rounded and compiles to a single instruction on most targets.
+#define EASINGS_FAST_SINCOS_ULP         2.0f
+#define EASINGS_FAST_SINCOS_ULP_WIDE    4.0f
+#define EASINGS_FAST_EXP2_ULP           2.0f
+
+#define EASINGS_FAST_PIO2_1         1.5703125f                  // PI/2 split in three parts,
+#define EASINGS_FAST_PIO2_2         4.837512969970703125e-4f    // so j*PIO2_1 is exact
+#define EASINGS_FAST_PIO2_3         7.54978995489188216e-8f
+#define EASINGS_FAST_SIN_C3        -1.6666654611e-1f            // sin(x) minimax on [-PI/4, PI/4]
+#define EASINGS_FAST_SIN_C5         8.3321608736e-3f
+#define EASINGS_FAST_SIN_C7        -1.9515295891e-4f
+#define EASINGS_FAST_COS_C4         4.166664568298827e-2f       // cos(x) minimax on [-PI/4, PI/4]
+#define EASINGS_FAST_COS_C6        -1.388731625493765e-3f
+#define EASINGS_FAST_COS_C8         2.443315711809948e-5f
+#define EASINGS_FAST_EXP2_C1        6.931472028550421e-1f       // 2^x minimax on [-0.5, 0.5]
+#define EASINGS_FAST_EXP2_C2        2.402264791363012e-1f
+#define EASINGS_FAST_EXP2_C3        5.550332471162809e-2f
+#define EASINGS_FAST_EXP2_C4        9.618437357674640e-3f
+#define EASINGS_FAST_EXP2_C5        1.339887440266574e-3f
+#define EASINGS_FAST_EXP2_C6        1.535336188319500e-4f
+
+// Computes sin(x) for quadrant 0 and cos(x) for quadrant 1
+// NOTE: Branch and call free, so loops using it can be vectorized (-O3). |x| must be under 2^30
+EASEDEF float EaseFastSinCosf(float x, int quadrant);
+EASEDEF float EaseFastSinf(float x);
+EASEDEF float EaseFastCosf(float x);
+
+// Computes 2^x, results under 2^-127 are flushed to 0.0f. |x| must be under 2^30
+EASEDEF float EaseFastExp2f(float x);
+
+#if defined(EASINGS_FAST_MATH)
+    #define EASINGS_SINF(x)     EaseFastSinf(x)
+    #define EASINGS_COSF(x)     EaseFastCosf(x)
+#else
+    #define EASINGS_SINF(x)     sinf(x)
+    #define EASINGS_COSF(x)     cosf(x)
+#endif
+
+#if defined(EASINGS_FAST_MATH) || defined(EASINGS_FAST_EXP2)
+    #define EASINGS_EXP2F(x)    EaseFastExp2f(x)
+#else
+    #define EASINGS_EXP2F(x)    powf(2.0f, (x))
+#endif
+
+// Returns a if condition is true, b otherwise, without branching
+// NOTE: Blends the bits, so it is exact for any value and loops using it can be vectorized
+EASEDEF float EaseSelectf(int condition, float a, float b);
+
+// Normalized Easing functions
+// NOTE: EaseXxxU() maps normalized time u = t/d to the curve, 0.0f at u = 0 and 1.0f at u = 1
+// (Back and Elastic overshoot in between). The Penner functions further down are all
+// c*EaseXxxU(t/d) + b, so one curve value can be applied to as many b/c pairs as needed.
+// With EASINGS_BRANCHLESS, InOut halves, Bounce segments and Expo/Elastic end points are picked
+// with EaseSelectf() instead of branches. Both halves share one expression (or one exp2) with
+// selected operands, results are the same bit for bit and batch loops can be vectorized, but
+// single calls pay for the blends even when the branches would have been predicted.
+#define EASINGS_HAS_CURVES
+
+// Linear Easing curves
+EASEDEF float EaseLinearNoneU(float u);
+EASEDEF float EaseLinearInU(float u);
+EASEDEF float EaseLinearOutU(float u);
+EASEDEF float EaseLinearInOutU(float u);
+
+// Sine Easing curves
+EASEDEF float EaseSineInU(float u);
+EASEDEF float EaseSineOutU(float u);
+EASEDEF float EaseSineInOutU(float u);
+
+// Circular Easing curves
+EASEDEF float EaseCircInU(float u);
+EASEDEF float EaseCircOutU(float u);
+EASEDEF float EaseCircInOutU(float u);
+
+// Cubic Easing curves
+EASEDEF float EaseCubicInU(float u);
+EASEDEF float EaseCubicOutU(float u);
+EASEDEF float EaseCubicInOutU(float u);
+
+// Quadratic Easing curves
+EASEDEF float EaseQuadInU(float u);
+EASEDEF float EaseQuadOutU(float u);
+EASEDEF float EaseQuadInOutU(float u);
+
+// Exponential Easing curves
+EASEDEF float EaseExpoInU(float u);
+EASEDEF float EaseExpoOutU(float u);
+EASEDEF float EaseExpoInOutU(float u);
+
+// Back Easing curves
+EASEDEF float EaseBackInU(float u);
+EASEDEF float EaseBackOutU(float u);
+EASEDEF float EaseBackInOutU(float u);
+
+// Bounce Easing curves
+EASEDEF float EaseBounceOutU(float u);
+EASEDEF float EaseBounceInU(float u);
+EASEDEF float EaseBounceInOutU(float u);
+
+// Elastic Easing curves
+// NOTE: Period p = 0.3f and phase s = p/4 in units of d, so (t*d - s)*(2*PI)/p becomes (u - s)*(2*PI)/p
+EASEDEF float EaseElasticInU(float u);
+EASEDEF float EaseElasticOutU(float u);
+
+// NOTE: Like the original Penner function, the phase is measured in half durations
+EASEDEF float EaseElasticInOutU(float u);
 
 // Linear Easing functions
-EASEDEF float EaseLinearNone(float t, float b, float c, float d) { return (c*t/d + b); }
-EASEDEF float EaseLinearIn(float t, float b, float c, float d) { return (c*t/d + b); }
-EASEDEF float EaseLinearOut(float t, float b, float c, float d) { return (c*t/d + b); }
-EASEDEF float EaseLinearInOut(float t,float b, float c, float d) { return (c*t/d + b); }
+EASEDEF float EaseLinearNone(float t, float b, float c, float d);
+EASEDEF float EaseLinearIn(float t, float b, float c, float d);
+EASEDEF float EaseLinearOut(float t, float b, float c, float d);
+EASEDEF float EaseLinearInOut(float t,float b, float c, float d);
 
 // Sine Easing functions
-EASEDEF float EaseSineIn(float t, float b, float c, float d) { return (-c*cosf(t/d*(PI/2.0f)) + c + b); }
-EASEDEF float EaseSineOut(float t, float b, float c, float d) { return (c*sinf(t/d*(PI/2.0f)) + b); }
-EASEDEF float EaseSineInOut(float t, float b, float c, float d) { return (-c/2.0f*(cosf(PI*t/d) - 1.0f) + b); }
+EASEDEF float EaseSineIn(float t, float b, float c, float d);
+EASEDEF float EaseSineOut(float t, float b, float c, float d);
+EASEDEF float EaseSineInOut(float t, float b, float c, float d);
 
 // Circular Easing functions
-EASEDEF float EaseCircIn(float t, float b, float c, float d) { t /= d; return (-c*(sqrtf(1.0f - t*t) - 1.0f) + b); }
-EASEDEF float EaseCircOut(float t, float b, float c, float d) { t = t/d - 1.0f; return (c*sqrtf(1.0f - t*t) + b); }
-EASEDEF float EaseCircInOut(float t, float b, float c, float d)
+EASEDEF float EaseCircIn(float t, float b, float c, float d);
+EASEDEF float EaseCircOut(float t, float b, float c, float d);
+EASEDEF float EaseCircInOut(float t, float b, float c, float d);
+
+// Cubic Easing functions
+EASEDEF float EaseCubicIn(float t, float b, float c, float d);
+EASEDEF float EaseCubicOut(float t, float b, float c, float d);
+EASEDEF float EaseCubicInOut(float t, float b, float c, float d);
+
+// Quadratic Easing functions
+EASEDEF float EaseQuadIn(float t, float b, float c, float d);
+EASEDEF float EaseQuadOut(float t, float b, float c, float d);
+EASEDEF float EaseQuadInOut(float t, float b, float c, float d);
+
+// Exponential Easing functions
+EASEDEF float EaseExpoIn(float t, float b, float c, float d);
+EASEDEF float EaseExpoOut(float t, float b, float c, float d);
+EASEDEF float EaseExpoInOut(float t, float b, float c, float d);
+
+// Back Easing functions
+EASEDEF float EaseBackIn(float t, float b, float c, float d);
+EASEDEF float EaseBackOut(float t, float b, float c, float d);
+EASEDEF float EaseBackInOut(float t, float b, float c, float d);
+
+// Bounce Easing functions
+EASEDEF float EaseBounceOut(float t, float b, float c, float d);
+EASEDEF float EaseBounceIn(float t, float b, float c, float d);
+EASEDEF float EaseBounceInOut(float t, float b, float c, float d);
+
+// Elastic Easing functions
+EASEDEF float EaseElasticIn(float t, float b, float c, float d);
+EASEDEF float EaseElasticOut(float t, float b, float c, float d);
+EASEDEF float EaseElasticInOut(float t, float b, float c, float d);
+
+// Derivative Easing functions
+// NOTE: EaseXxxDerivU() is the analytic derivative of EaseXxxU() over u, EaseXxxFusedU() returns
+// EaseXxxU(u) (same bits) and writes the derivative to *derivU, sharing the sqrtf(), exp2 and
+// sine angle between both. EaseXxxDeriv() and EaseXxxFused() are the same over t for the Penner
+// functions, the derivative being the velocity c*derivU/d. Where a curve jumps (Expo and Elastic
+// at u = 0 and 1) the derivative of the curve expression is returned, Circ derivatives are
+// infinite at the vertical ends. Derivatives always branch, even with EASINGS_BRANCHLESS.
+// Use easings_results --deriv to compare them against numerical derivatives.
+#define EASINGS_HAS_DERIVATIVES
+
+#define EASINGS_LN2 0.693147180559945309f
+
+// Linear Easing derivatives
+EASEDEF float EaseLinearNoneDerivU(float u);
+EASEDEF float EaseLinearInDerivU(float u);
+EASEDEF float EaseLinearOutDerivU(float u);
+EASEDEF float EaseLinearInOutDerivU(float u);
+
+EASEDEF float EaseLinearNoneFusedU(float u, float *derivU);
+EASEDEF float EaseLinearInFusedU(float u, float *derivU);
+EASEDEF float EaseLinearOutFusedU(float u, float *derivU);
+EASEDEF float EaseLinearInOutFusedU(float u, float *derivU);
+
+// Sine Easing derivatives
+EASEDEF float EaseSineInDerivU(float u);
+EASEDEF float EaseSineOutDerivU(float u);
+EASEDEF float EaseSineInOutDerivU(float u);
+
+EASEDEF float EaseSineInFusedU(float u, float *derivU);
+EASEDEF float EaseSineOutFusedU(float u, float *derivU);
+EASEDEF float EaseSineInOutFusedU(float u, float *derivU);
+
+// Circular Easing derivatives
+EASEDEF float EaseCircInDerivU(float u);
+EASEDEF float EaseCircOutDerivU(float u);
+EASEDEF float EaseCircInOutDerivU(float u);
+EASEDEF float EaseCircInFusedU(float u, float *derivU);
+EASEDEF float EaseCircOutFusedU(float u, float *derivU);
+EASEDEF float EaseCircInOutFusedU(float u, float *derivU);
+
+// Cubic Easing derivatives
+EASEDEF float EaseCubicInDerivU(float u);
+EASEDEF float EaseCubicOutDerivU(float u);
+EASEDEF float EaseCubicInOutDerivU(float u);
+EASEDEF float EaseCubicInFusedU(float u, float *derivU);
+EASEDEF float EaseCubicOutFusedU(float u, float *derivU);
+EASEDEF float EaseCubicInOutFusedU(float u, float *derivU);
+
+// Quadratic Easing derivatives
+EASEDEF float EaseQuadInDerivU(float u);
+EASEDEF float EaseQuadOutDerivU(float u);
+EASEDEF float EaseQuadInOutDerivU(float u);
+EASEDEF float EaseQuadInFusedU(float u, float *derivU);
+EASEDEF float EaseQuadOutFusedU(float u, float *derivU);
+EASEDEF float EaseQuadInOutFusedU(float u, float *derivU);
+
+// Exponential Easing derivatives
+EASEDEF float EaseExpoInDerivU(float u);
+EASEDEF float EaseExpoOutDerivU(float u);
+EASEDEF float EaseExpoInOutDerivU(float u);
+EASEDEF float EaseExpoInFusedU(float u, float *derivU);
+EASEDEF float EaseExpoOutFusedU(float u, float *derivU);
+EASEDEF float EaseExpoInOutFusedU(float u, float *derivU);
+
+// Back Easing derivatives
+EASEDEF float EaseBackInDerivU(float u);
+EASEDEF float EaseBackOutDerivU(float u);
+EASEDEF float EaseBackInOutDerivU(float u);
+EASEDEF float EaseBackInFusedU(float u, float *derivU);
+EASEDEF float EaseBackOutFusedU(float u, float *derivU);
+EASEDEF float EaseBackInOutFusedU(float u, float *derivU);
+
+// Bounce Easing derivatives
+EASEDEF float EaseBounceOutDerivU(float u);
+EASEDEF float EaseBounceInDerivU(float u);
+EASEDEF float EaseBounceInOutDerivU(float u);
+
+// NOTE: The fused functions pick the bounce segment once, for the value and the derivative
+EASEDEF float EaseBounceOutFusedU(float u, float *derivU);
+EASEDEF float EaseBounceInFusedU(float u, float *derivU);
+EASEDEF float EaseBounceInOutFusedU(float u, float *derivU);
+
+// Elastic Easing derivatives
+// NOTE: d/du of e*sin(a) is e*(k*ln2*sin(a) + w*cos(a)), for e = 2^(k*u) and a = w*u + phase
+EASEDEF float EaseElasticInFusedU(float u, float *derivU);
+EASEDEF float EaseElasticOutFusedU(float u, float *derivU);
+EASEDEF float EaseElasticInOutFusedU(float u, float *derivU);
+
+// NOTE: The Elastic derivative needs the sine and the cosine anyway, so it is the fused function
+EASEDEF float EaseElasticInDerivU(float u);
+EASEDEF float EaseElasticOutDerivU(float u);
+EASEDEF float EaseElasticInOutDerivU(float u);
+
+// Derivatives over t of the Penner functions
+#define EASINGS_DERIV_DECLARE(func) \
+    EASEDEF float func##Deriv(float t, float b, float c, float d); \
+    EASEDEF float func##Fused(float t, float b, float c, float d, float *velocity);
+
+EASINGS_DERIV_DECLARE(EaseLinearNone)
+EASINGS_DERIV_DECLARE(EaseLinearIn)
+EASINGS_DERIV_DECLARE(EaseLinearOut)
+EASINGS_DERIV_DECLARE(EaseLinearInOut)
+
+EASINGS_DERIV_DECLARE(EaseSineIn)
+EASINGS_DERIV_DECLARE(EaseSineOut)
+EASINGS_DERIV_DECLARE(EaseSineInOut)
+
+EASINGS_DERIV_DECLARE(EaseCircIn)
+EASINGS_DERIV_DECLARE(EaseCircOut)
+EASINGS_DERIV_DECLARE(EaseCircInOut)
+
+EASINGS_DERIV_DECLARE(EaseCubicIn)
+EASINGS_DERIV_DECLARE(EaseCubicOut)
+EASINGS_DERIV_DECLARE(EaseCubicInOut)
+
+EASINGS_DERIV_DECLARE(EaseQuadIn)
+EASINGS_DERIV_DECLARE(EaseQuadOut)
+EASINGS_DERIV_DECLARE(EaseQuadInOut)
+
+EASINGS_DERIV_DECLARE(EaseExpoIn)
+EASINGS_DERIV_DECLARE(EaseExpoOut)
+EASINGS_DERIV_DECLARE(EaseExpoInOut)
+
+EASINGS_DERIV_DECLARE(EaseBackIn)
+EASINGS_DERIV_DECLARE(EaseBackOut)
+EASINGS_DERIV_DECLARE(EaseBackInOut)
+
+EASINGS_DERIV_DECLARE(EaseBounceOut)
+EASINGS_DERIV_DECLARE(EaseBounceIn)
+EASINGS_DERIV_DECLARE(EaseBounceInOut)
+
+EASINGS_DERIV_DECLARE(EaseElasticIn)
+EASINGS_DERIV_DECLARE(EaseElasticOut)
+EASINGS_DERIV_DECLARE(EaseElasticInOut)
+
+// Evaluates the derivative of the normalized curve of any easing type
+EASEDEF float EaseCurveDerivU(EaseType type, float u);
+
+// Evaluates the normalized curve of any easing type and its derivative
+EASEDEF float EaseCurveFusedU(EaseType type, float u, float *derivU);
+
+// Prepared Easing functions
+// NOTE: EasePrepare() does the per-tween work once (1/d), EasePreparedEval() then only multiplies t
+// by it and evaluates the curve. Results may differ from the four argument functions in the last
+// bit, as t*(1/d) is not always rounded like t/d.
+#define EASINGS_HAS_PREPARED
+
+typedef struct EasePrepared {
+    EaseType type;
+    float b;            // Starting value
+    float c;            // Total change in value
+    float d;            // Duration, kept so t == d still gives exactly u = 1
+    float invD;         // 1.0f/d
+} EasePrepared;
+
+EASEDEF EasePrepared EasePrepare(EaseType type, float b, float c, float d);
+
+// Evaluates the normalized curve of any easing type
+EASEDEF float EaseCurveU(EaseType type, float u);
+EASEDEF float EasePreparedEval(const EasePrepared *ease, float t);
+
+// Vector Easing functions
+// NOTE: Positions, scales and colours move all their channels along the same curve, so the curve
+// (and its powf(), sinf() or sqrtf()) is evaluated once per value and applied to the b and c of
+// each channel. Every channel gets c*EaseCurveU(type, t/d) + b, the same as the scalar functions
+// bit for bit. EaseVectorN() takes n values with their channels interleaved (AoS, out[i*channels + k]),
+// EaseVectorSoAN() one array per channel (SoA, out[k][i]). Both evaluate the curves in chunks of
+// EASINGS_VECTOR_CHUNK values with the type switch outside of the loops.
+#define EASINGS_HAS_VECTOR
+
+#define EASINGS_VECTOR_CHUNK        256
+
+typedef struct EaseVec2 {
+    float x;
+    float y;
+} EaseVec2;
+
+typedef struct EaseVec3 {
+    float x;
+    float y;
+    float z;
+} EaseVec3;
+
+typedef struct EaseVec4 {
+    float x;
+    float y;
+    float z;
+    float w;
+} EaseVec4;
+
+typedef struct EaseColor {
+    unsigned char r;
+    unsigned char g;
+    unsigned char b;
+    unsigned char a;
+} EaseColor;
+
+// Evaluates the normalized curve of any easing type for n values of u
+EASEDEF void EaseCurveUN(EaseType type, const float *EASINGS_RESTRICT u, float *EASINGS_RESTRICT out, size_t n);
+
+// Eases the channels of one value, each with its own b and c, along one curve
+EASEDEF void EaseVector(EaseType type, float t, const float *EASINGS_RESTRICT b, const float *EASINGS_RESTRICT c, float d,
+                        float *EASINGS_RESTRICT out, int channels);
+EASEDEF EaseVec2 EaseVector2(EaseType type, float t, EaseVec2 b, EaseVec2 c, float d);
+EASEDEF EaseVec3 EaseVector3(EaseType type, float t, EaseVec3 b, EaseVec3 c, float d);
+EASEDEF EaseVec4 EaseVector4(EaseType type, float t, EaseVec4 b, EaseVec4 c, float d);
+
+// Eases a colour from start to end, rounding each channel to [0, 255]
+// NOTE: Back and Elastic overshoot the end colour, the overshoot is clamped
+EASEDEF EaseColor EaseColorBlend(EaseType type, float t, EaseColor start, EaseColor end, float d);
+
+// Eases n values of channels channels, b, c and out interleaved as b[i*channels + k] (AoS)
+EASEDEF void EaseVectorN(EaseType type, const float *EASINGS_RESTRICT t, float *EASINGS_RESTRICT out, size_t n, int channels,
+                         const float *EASINGS_RESTRICT b, const float *EASINGS_RESTRICT c, float d);
+
+// Eases n values of channels channels, b, c and out given as one array per channel, b[k][i] (SoA)
+EASEDEF void EaseVectorSoAN(EaseType type, const float *EASINGS_RESTRICT t, float *const *out, size_t n, int channels,
+                            const float *const *b, const float *const *c, float d);
+
+// Dispatch Easing functions
+// NOTE: EaseDispatchN() eases n items of mixed types without calling through a function pointer
+// per item. Items are bucketed by type with a counting sort into order (n entries, given by the
+// caller), then the u of each bucket is gathered in chunks of EASINGS_VECTOR_CHUNK and run through
+// the inlined loop of its type (EaseCurveUN()). u = t/d and c*curve + b are computed in order, in
+// out, so only the curve values are gathered and scattered. Items of unknown types get b.
+// Results match the scalar functions bit for bit.
+#define EASINGS_HAS_DISPATCH
+
+EASEDEF void EaseDispatchN(const EaseType *EASINGS_RESTRICT types, const float *EASINGS_RESTRICT t,
+                           float *EASINGS_RESTRICT out, size_t n, const float *EASINGS_RESTRICT b,
+                           const float *EASINGS_RESTRICT c, const float *EASINGS_RESTRICT d,
+                           uint32_t *EASINGS_RESTRICT order);
+
+// Table Easing functions
+// NOTE: The normalized curve of each type is sampled into a table of EaseTableSetSize() entries
+// the first time it is used, then evaluated with linear or Catmull-Rom interpolation. u is
+// clamped to [0, 1], where the exact end values are returned. Tables are shared and built on demand, so the first call per type is
+// slow and the functions are not thread safe. If a table can't be allocated, the exact curve
+// is used instead. Use easings_results --lut to see the error of each size and interpolation.
+#define EASINGS_HAS_TABLE
+
+#define EASINGS_TABLE_MIN_SIZE          256
+#define EASINGS_TABLE_MAX_SIZE          65536
+#define EASINGS_TABLE_DEFAULT_SIZE      1024
+
+typedef enum {
+    EASE_TABLE_LINEAR = 0,          // Linear interpolation between the two nearest samples
+    EASE_TABLE_CATMULL_ROM          // Cubic interpolation over the four nearest samples
+} EaseTableInterp;
+
+// Frees all tables, they are built again on next use
+EASEDEF void EaseTableFree(void);
+
+// Sets the number of samples per table, clamped to [EASINGS_TABLE_MIN_SIZE, EASINGS_TABLE_MAX_SIZE]
+// NOTE: Tables built with a different size are freed
+EASEDEF void EaseTableSetSize(int size);
+EASEDEF int EaseTableGetSize(void);
+
+// Returns the table of an easing type, building it if needed (NULL if the type is invalid or it can't be allocated)
+EASEDEF const float *EaseTableGet(EaseType type);
+
+// Evaluates the normalized curve of an easing type from its table
+EASEDEF float EaseTableU(EaseType type, float u, EaseTableInterp interp);
+EASEDEF float EaseTable(EaseType type, float t, float b, float c, float d, EaseTableInterp interp);
+
+// Stepper Easing functions
+// NOTE: An EaseStepper generates the values of one tween at t, t + td, t + 2*td... at a fixed rate.
+// Linear, Quad, Cubic and Back advance with forward differences (three adds per value), Sine,
+// Expo and Elastic with a rotation recurrence for the sine and a product for the exp2 (a few
+// multiplies per value). The state is rebuilt from the exact curve every EASINGS_STEPPER_RESYNC
+// steps and at u = 0, 0.5 and 1 (where the InOut halves meet and Expo/Elastic jump to their end
+// values), so drift stays bounded and the value at each rebuild step is exact. Circ and Bounce are
+// evaluated exactly at every step. Use easings_results --stepper to see the error of each type.
+#define EASINGS_HAS_STEPPER
+
+#define EASINGS_STEPPER_RESYNC      64
+
+typedef enum {
+    EASE_STEPPER_EXACT = 0,         // EaseCurveU() at every step
+    EASE_STEPPER_POLY,              // Cubic polynomial, forward differences
+    EASE_STEPPER_WAVE               // base + amp*2^(k*x)*sin(w*x + phase), rotation recurrence
+} EaseStepperKind;
+
+typedef struct EaseStepper {
+    EaseType type;
+    EaseStepperKind kind;
+    float t;            // Time of step 0
+    float td;           // Time advanced per step
+    float b;            // Starting value
+    float c;            // Total change in value
+    float d;            // Duration
+    int n;              // Step of the next value
+    int end;            // Step where the state is rebuilt
+    float v;            // EASE_STEPPER_POLY: next value and its forward differences
+    float d1;
+    float d2;
+    float d3;
+    float base;         // EASE_STEPPER_WAVE: value around which the wave moves
+    float amp;          // Scale of the next sine value (c and the exp2 factor included)
+    float grow;         // Factor applied to amp per step
+    float sn;           // Sine and cosine of the next angle
+    float cs;
+    float rotSin;       // Sine and cosine of the angle advanced per step
+    float rotCos;
+} EaseStepper;
+
+EASEDEF float EaseStepperTime(const EaseStepper *stepper, int n);
+
+// Returns the exact value of the current step and sets up the state for the next ones
+EASEDEF float EaseStepperRestart(EaseStepper *stepper);
+
+// Starts a stepper at time t, advancing td per value (td > 0, other steps are evaluated exactly)
+EASEDEF EaseStepper EaseStepperStart(EaseType type, float t, float td, float b, float c, float d);
+
+// Returns the value at the current step and advances to the next one
+EASEDEF float EaseStepperNext(EaseStepper *stepper);
+
+// Bezier Easing functions
+// NOTE: CSS cubic-bezier(x1, y1, x2, y2) timing functions, the curve from (0, 0) to (1, 1) with
+// control points (x1, y1) and (x2, y2), x1 and x2 in [0, 1] so x grows with the curve parameter s.
+// EaseBezierCreate() samples x(s) at EASINGS_BEZIER_SAMPLES evenly spaced s, EaseBezierU() then
+// finds the sample segment holding u, interpolates s in it and refines it with at most
+// EASINGS_BEZIER_NEWTON_ITERATIONS Newton steps, or EASINGS_BEZIER_BISECTION_ITERATIONS bisection
+// steps where the curve is too flat in x for Newton, so every evaluation takes a bounded time.
+// EASINGS_BEZIER_INIT() gives the same struct as a constant initializer, used for the CSS keywords.
+// Use easings_results --bezier to see the error against a double precision solver.
+#define EASINGS_HAS_BEZIER
+
+#define EASINGS_BEZIER_SAMPLES              11      // NOTE: EASINGS_BEZIER_INIT() lists 11 samples
+#define EASINGS_BEZIER_NEWTON_ITERATIONS    4
+#define EASINGS_BEZIER_NEWTON_MIN_SLOPE     0.001f
+#define EASINGS_BEZIER_BISECTION_ITERATIONS 20
+#define EASINGS_BEZIER_PRECISION            1e-7f
+
+typedef struct EaseBezier {
+    float ax;           // x(s) = ((ax*s + bx)*s + cx)*s
+    float bx;
+    float cx;
+    float ay;           // y(s) = ((ay*s + by)*s + cy)*s
+    float by;
+    float cy;
+    float samples[EASINGS_BEZIER_SAMPLES];  // x(s) at s = i/(EASINGS_BEZIER_SAMPLES - 1)
+} EaseBezier;
+
+// Polynomial coefficients of one coordinate, from its two control point values
+#define EASINGS_BEZIER_A(p1, p2) (1.0f + 3.0f*(p1) - 3.0f*(p2))
+#define EASINGS_BEZIER_B(p1, p2) (3.0f*(p2) - 6.0f*(p1))
+#define EASINGS_BEZIER_C(p1, p2) (3.0f*(p1))
+#define EASINGS_BEZIER_X(x1, x2, s) \
+    (((EASINGS_BEZIER_A(x1, x2)*(s) + EASINGS_BEZIER_B(x1, x2))*(s) + EASINGS_BEZIER_C(x1, x2))*(s))
+
+#define EASINGS_BEZIER_INIT(x1, y1, x2, y2) { \
+    EASINGS_BEZIER_A(x1, x2), EASINGS_BEZIER_B(x1, x2), EASINGS_BEZIER_C(x1, x2), \
+    EASINGS_BEZIER_A(y1, y2), EASINGS_BEZIER_B(y1, y2), EASINGS_BEZIER_C(y1, y2), { \
+        EASINGS_BEZIER_X(x1, x2, 0.0f/10.0f), \
+        EASINGS_BEZIER_X(x1, x2, 1.0f/10.0f), \
+        EASINGS_BEZIER_X(x1, x2, 2.0f/10.0f), \
+        EASINGS_BEZIER_X(x1, x2, 3.0f/10.0f), \
+        EASINGS_BEZIER_X(x1, x2, 4.0f/10.0f), \
+        EASINGS_BEZIER_X(x1, x2, 5.0f/10.0f), \
+        EASINGS_BEZIER_X(x1, x2, 6.0f/10.0f), \
+        EASINGS_BEZIER_X(x1, x2, 7.0f/10.0f), \
+        EASINGS_BEZIER_X(x1, x2, 8.0f/10.0f), \
+        EASINGS_BEZIER_X(x1, x2, 9.0f/10.0f), \
+        EASINGS_BEZIER_X(x1, x2, 10.0f/10.0f) } }
+
+// Creates a bezier easing, x1 and x2 are clamped to [0, 1]
+EASEDEF EaseBezier EaseBezierCreate(float x1, float y1, float x2, float y2);
+
+// Evaluates the normalized curve of a bezier easing, u is clamped to [0, 1]
+EASEDEF float EaseBezierU(const EaseBezier *bezier, float u);
+EASEDEF float EaseBezierEval(const EaseBezier *bezier, float t, float b, float c, float d);
+EASEDEF float EaseCssEase(float t, float b, float c, float d);
+EASEDEF float EaseCssEaseIn(float t, float b, float c, float d);
+EASEDEF float EaseCssEaseOut(float t, float b, float c, float d);
+EASEDEF float EaseCssEaseInOut(float t, float b, float c, float d);
+
+// Parameterized Easing functions
+// NOTE: Back and Elastic with their overshoot, amplitude and period as parameters. The coefficients
+// derived from them (s + 1, 2*PI/p, the phase) are computed once into an EaseBackParams or
+// EaseElasticParams, so the EaseXxxExU() functions do no divisions (EaseXxxEx() only t/d).
+// Like the fixed functions, InOut uses 1.525 times the overshoot and 1.5 times the period, and
+// amplitudes under 1 (c) are raised to 1 as in the Penner functions. With the default parameters,
+// Back gives the same results as the fixed functions bit for bit; Elastic may differ in the last bits,
+// as the angle is computed as u*w + phase. Use easings_results --params to see the error.
+#define EASINGS_HAS_PARAMS
+
+#define EASINGS_BACK_OVERSHOOT      1.70158f    // s of EaseBackIn()
+#define EASINGS_ELASTIC_PERIOD      0.3f        // p of EaseElasticIn(), in units of d
+
+typedef struct EaseBackParams {
+    float s;            // Overshoot
+    float s1;           // s + 1
+    float sInOut;       // Overshoot of InOut, s*1.525f
+    float sInOut1;      // sInOut + 1
+} EaseBackParams;
+
+typedef struct EaseElasticParams {
+    float a;            // Amplitude, as a multiple of c (at least 1)
+    float w;            // Angle advanced per unit of u, 2*PI/p
+    float phase;        // Angle at the end points (u = 1 for In, u = 0 for Out): -s*w
+    float wInOut;       // Same for InOut, over v = 2*u - 1 and with 1.5 times the period
+    float phaseInOut;
+} EaseElasticParams;
+
+EASEDEF EaseBackParams EaseBackParamsCreate(float overshoot);
+
+// Creates the coefficients of an elastic easing, a period under or equal to 0 gets the default one
+EASEDEF EaseElasticParams EaseElasticParamsCreate(float amplitude, float period);
+
+EASEDEF float EaseBackInExU(const EaseBackParams *params, float u);
+EASEDEF float EaseBackOutExU(const EaseBackParams *params, float u);
+EASEDEF float EaseBackInOutExU(const EaseBackParams *params, float u);
+
+EASEDEF float EaseElasticInExU(const EaseElasticParams *params, float u);
+EASEDEF float EaseElasticOutExU(const EaseElasticParams *params, float u);
+EASEDEF float EaseElasticInOutExU(const EaseElasticParams *params, float u);
+
+EASEDEF float EaseBackInEx(const EaseBackParams *params, float t, float b, float c, float d);
+EASEDEF float EaseBackOutEx(const EaseBackParams *params, float t, float b, float c, float d);
+EASEDEF float EaseBackInOutEx(const EaseBackParams *params, float t, float b, float c, float d);
+
+EASEDEF float EaseElasticInEx(const EaseElasticParams *params, float t, float b, float c, float d);
+EASEDEF float EaseElasticOutEx(const EaseElasticParams *params, float t, float b, float c, float d);
+EASEDEF float EaseElasticInOutEx(const EaseElasticParams *params, float t, float b, float c, float d);
+
+// Batch Easing functions
+// NOTE: EaseXxxN() computes n values sharing the same b, c and d, EaseXxxNV() takes b, c and d
+// per element. Both loop over the inlined scalar function, so results match it exactly and
+// the loop body is free of calls (except libm ones) for the compiler to vectorize.
+#define EASINGS_HAS_BATCH
+
+#define EASINGS_BATCH_DECLARE(func) \
+    EASEDEF void func##N(const float *EASINGS_RESTRICT t, float *EASINGS_RESTRICT out, size_t n, \
+                         float b, float c, float d); \
+    EASEDEF void func##NV(const float *EASINGS_RESTRICT t, float *EASINGS_RESTRICT out, size_t n, \
+                          const float *EASINGS_RESTRICT b, const float *EASINGS_RESTRICT c, \
+                          const float *EASINGS_RESTRICT d);
+
+EASINGS_BATCH_DECLARE(EaseLinearNone)
+EASINGS_BATCH_DECLARE(EaseLinearIn)
+EASINGS_BATCH_DECLARE(EaseLinearOut)
+EASINGS_BATCH_DECLARE(EaseLinearInOut)
+
+EASINGS_BATCH_DECLARE(EaseSineIn)
+EASINGS_BATCH_DECLARE(EaseSineOut)
+EASINGS_BATCH_DECLARE(EaseSineInOut)
+
+EASINGS_BATCH_DECLARE(EaseCircIn)
+EASINGS_BATCH_DECLARE(EaseCircOut)
+EASINGS_BATCH_DECLARE(EaseCircInOut)
+
+EASINGS_BATCH_DECLARE(EaseCubicIn)
+EASINGS_BATCH_DECLARE(EaseCubicOut)
+EASINGS_BATCH_DECLARE(EaseCubicInOut)
+
+EASINGS_BATCH_DECLARE(EaseQuadIn)
+EASINGS_BATCH_DECLARE(EaseQuadOut)
+EASINGS_BATCH_DECLARE(EaseQuadInOut)
+
+EASINGS_BATCH_DECLARE(EaseExpoIn)
+EASINGS_BATCH_DECLARE(EaseExpoOut)
+EASINGS_BATCH_DECLARE(EaseExpoInOut)
+
+EASINGS_BATCH_DECLARE(EaseBackIn)
+EASINGS_BATCH_DECLARE(EaseBackOut)
+EASINGS_BATCH_DECLARE(EaseBackInOut)
+
+EASINGS_BATCH_DECLARE(EaseBounceOut)
+EASINGS_BATCH_DECLARE(EaseBounceIn)
+EASINGS_BATCH_DECLARE(EaseBounceInOut)
+
+EASINGS_BATCH_DECLARE(EaseElasticIn)
+EASINGS_BATCH_DECLARE(EaseElasticOut)
+EASINGS_BATCH_DECLARE(EaseElasticInOut)
+
+EASINGS_BATCH_DECLARE(EaseCssEase)
+EASINGS_BATCH_DECLARE(EaseCssEaseIn)
+EASINGS_BATCH_DECLARE(EaseCssEaseOut)
+EASINGS_BATCH_DECLARE(EaseCssEaseInOut)
+
+#ifdef __cplusplus
+}
+#endif
+
+/***********************************************************************************
+*
+*   EASINGS IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(EASINGS_STATIC_INLINE) || defined(EASINGS_IMPLEMENTATION)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Fast math functions
+
+EASEDEF float EaseFastSinCosf(float x, int quadrant)
 {
-    if ((t/=d/2.0f) < 1.0f) return (-c/2.0f*(sqrtf(1.0f - t*t) - 1.0f) + b);
-    t -= 2.0f; return (c/2.0f*(sqrtf(1.0f - t*t) + 1.0f) + b);
+    float y = x*(2.0f/PI);
+
+    // Reduce x to r in [-PI/4, PI/4] around the nearest multiple j of PI/2
+    int j = (int)(y + copysignf(0.5f, y));
+    float r = x - (float)j*EASINGS_FAST_PIO2_1;
+    r -= (float)j*EASINGS_FAST_PIO2_2;
+    r -= (float)j*EASINGS_FAST_PIO2_3;
+
+    float z = r*r;
+    float ps = ((EASINGS_FAST_SIN_C7*z + EASINGS_FAST_SIN_C5)*z + EASINGS_FAST_SIN_C3)*z*r + r;
+    float pc = ((EASINGS_FAST_COS_C8*z + EASINGS_FAST_COS_C6)*z + EASINGS_FAST_COS_C4)*z*z - 0.5f*z + 1.0f;
+
+    // Odd quadrants use the cosine polynomial, quadrants 2 and 3 flip the sign
+    // NOTE: Selected with exact arithmetic, GCC does not if-convert a plain (q & 1)? pc : ps
+    int q = j + quadrant;
+    float k = (float)(q & 1);
+    float sign = (float)(1 - (q & 2));
+
+    return (ps*(1.0f - k) + pc*k)*sign;
 }
 
-// Cubic Easing functions
-EASEDEF float EaseCubicIn(float t, float b, float c, float d) { t /= d; return (c*t*t*t + b); }
-EASEDEF float EaseCubicOut(float t, float b, float c, float d) { t = t/d - 1.0f; return (c*(t*t*t + 1.0f) + b); }
-EASEDEF float EaseCubicInOut(float t, float b, float c, float d)
+EASEDEF float EaseFastSinf(float x) { return EaseFastSinCosf(x, 0); }
+EASEDEF float EaseFastCosf(float x) { return EaseFastSinCosf(x, 1); }
+
+EASEDEF float EaseFastExp2f(float x)
 {
-    if ((t/=d/2.0f) < 1.0f) return (c/2.0f*t*t*t + b);
-    t -= 2.0f; return (c/2.0f*(t*t*t + 2.0f) + b);
+    // Split x = n + f with f in [-0.5, 0.5], 2^n goes straight into the exponent bits
+    // NOTE: n is clamped as an integer, GCC does not vectorize a float clamp feeding the conversion
+    int n = (int)(x + copysignf(0.5f, x));
+    float f = x - (float)n;
+    n = (n < -127)? -127 : ((n > 128)? 128 : n);
+    float p = (((((EASINGS_FAST_EXP2_C6*f + EASINGS_FAST_EXP2_C5)*f + EASINGS_FAST_EXP2_C4)*f +
+                EASINGS_FAST_EXP2_C3)*f + EASINGS_FAST_EXP2_C2)*f + EASINGS_FAST_EXP2_C1)*f + 1.0f;
+
+    uint32_t bits = (uint32_t)(n + 127) << 23;
+    float scale;
+    memcpy(&scale, &bits, sizeof(scale));
+
+    return p*scale;
 }
 
-// Quadratic Easing functions
-EASEDEF float EaseQuadIn(float t, float b, float c, float d) { t /= d; return (c*t*t + b); }
-EASEDEF float EaseQuadOut(float t, float b, float c, float d) { t /= d; return (-c*t*(t - 2.0f) + b); }
-EASEDEF float EaseQuadInOut(float t, float b, float c, float d)
+EASEDEF float EaseSelectf(int condition, float a, float b)
 {
-    if ((t/=d/2) < 1) return (((c/2)*(t*t)) + b);
-    return (-c/2.0f*(((t - 1.0f)*(t - 3.0f)) - 1.0f) + b);
+    uint32_t mask = (uint32_t)0 - (uint32_t)(condition != 0);
+    uint32_t ia, ib;
+    memcpy(&ia, &a, sizeof(ia));
+    memcpy(&ib, &b, sizeof(ib));
+
+    uint32_t bits = (ia & mask) | (ib & ~mask);
+    float result;
+    memcpy(&result, &bits, sizeof(result));
+
+    return result;
 }
 
-// Exponential Easing functions
-EASEDEF float EaseExpoIn(float t, float b, float c, float d) { return (t == 0.0f) ? b : (c*powf(2.0f, 10.0f*(t/d - 1.0f)) + b); }
-EASEDEF float EaseExpoOut(float t, float b, float c, float d) { return (t == d) ? (b + c) : (c*(-powf(2.0f, -10.0f*t/d) + 1.0f) + b);    }
-EASEDEF float EaseExpoInOut(float t, float b, float c, float d)
+// Linear Easing curves
+EASEDEF float EaseLinearNoneU(float u) { return u; }
+EASEDEF float EaseLinearInU(float u) { return u; }
+EASEDEF float EaseLinearOutU(float u) { return u; }
+EASEDEF float EaseLinearInOutU(float u) { return u; }
+
+// Sine Easing curves
+EASEDEF float EaseSineInU(float u) { return (1.0f - EASINGS_COSF(u*(PI/2.0f))); }
+EASEDEF float EaseSineOutU(float u) { return EASINGS_SINF(u*(PI/2.0f)); }
+EASEDEF float EaseSineInOutU(float u) { return (-0.5f*(EASINGS_COSF(PI*u) - 1.0f)); }
+
+// Circular Easing curves
+EASEDEF float EaseCircInU(float u) { return (1.0f - sqrtf(1.0f - u*u)); }
+EASEDEF float EaseCircOutU(float u) { u -= 1.0f; return sqrtf(1.0f - u*u); }
+EASEDEF float EaseCircInOutU(float u)
 {
-    if (t == 0.0f) return b;
-    if (t == d) return (b + c);
-    if ((t/=d/2.0f) < 1.0f) return (c/2.0f*powf(2.0f, 10.0f*(t - 1.0f)) + b);
+#if defined(EASINGS_BRANCHLESS)
+    int first = ((u*=2.0f) < 1.0f);
+    u -= EaseSelectf(first, 0.0f, 2.0f);
+    float sq = sqrtf(1.0f - u*u);
 
-    return (c/2.0f*(-powf(2.0f, -10.0f*(t - 1.0f)) + 2.0f) + b);
+    return EaseSelectf(first, -0.5f*(sq - 1.0f), 0.5f*(sq + 1.0f));
+#else
+    if ((u*=2.0f) < 1.0f) return (-0.5f*(sqrtf(1.0f - u*u) - 1.0f));
+    u -= 2.0f; return (0.5f*(sqrtf(1.0f - u*u) + 1.0f));
+#endif
 }
 
-// Back Easing functions
-EASEDEF float EaseBackIn(float t, float b, float c, float d)
+// Cubic Easing curves
+EASEDEF float EaseCubicInU(float u) { return (u*u*u); }
+EASEDEF float EaseCubicOutU(float u) { u -= 1.0f; return (u*u*u + 1.0f); }
+EASEDEF float EaseCubicInOutU(float u)
 {
-    float s = 1.70158f;
-    float postFix = t/=d;
-    return (c*(postFix)*t*((s + 1.0f)*t - s) + b);
+#if defined(EASINGS_BRANCHLESS)
+    int first = ((u*=2.0f) < 1.0f);
+    u -= EaseSelectf(first, 0.0f, 2.0f);
+    float r = u*u*u;
+
+    return (0.5f*EaseSelectf(first, r, r + 2.0f));
+#else
+    if ((u*=2.0f) < 1.0f) return (0.5f*u*u*u);
+    u -= 2.0f; return (0.5f*(u*u*u + 2.0f));
+#endif
 }
 
-EASEDEF float EaseBackOut(float t, float b, float c, float d)
+// Quadratic Easing curves
+EASEDEF float EaseQuadInU(float u) { return (u*u); }
+EASEDEF float EaseQuadOutU(float u) { return (-u*(u - 2.0f)); }
+EASEDEF float EaseQuadInOutU(float u)
+{
+#if defined(EASINGS_BRANCHLESS)
+    u *= 2.0f;
+    return EaseSelectf(u < 1.0f, 0.5f*(u*u), -0.5f*(((u - 1.0f)*(u - 3.0f)) - 1.0f));
+#else
+    if ((u*=2.0f) < 1.0f) return (0.5f*(u*u));
+    return (-0.5f*(((u - 1.0f)*(u - 3.0f)) - 1.0f));
+#endif
+}
+
+// Exponential Easing curves
+EASEDEF float EaseExpoInU(float u)
+{
+#if defined(EASINGS_BRANCHLESS)
+    return EaseSelectf(u == 0.0f, 0.0f, EASINGS_EXP2F(10.0f*(u - 1.0f)));
+#else
+    return (u == 0.0f) ? 0.0f : EASINGS_EXP2F(10.0f*(u - 1.0f));
+#endif
+}
+
+EASEDEF float EaseExpoOutU(float u)
+{
+#if defined(EASINGS_BRANCHLESS)
+    return EaseSelectf(u == 1.0f, 1.0f, -EASINGS_EXP2F(-10.0f*u) + 1.0f);
+#else
+    return (u == 1.0f) ? 1.0f : (-EASINGS_EXP2F(-10.0f*u) + 1.0f);
+#endif
+}
+
+EASEDEF float EaseExpoInOutU(float u)
+{
+#if defined(EASINGS_BRANCHLESS)
+    float u2 = u*2.0f;
+    int first = (u2 < 1.0f);
+    float x = 10.0f*(u2 - 1.0f);
+    float e = EASINGS_EXP2F(EaseSelectf(first, x, -x));
+    float r = EaseSelectf(first, 0.5f*e, 0.5f*(-e + 2.0f));
+
+    r = EaseSelectf(u == 1.0f, 1.0f, r);
+
+    return EaseSelectf(u == 0.0f, 0.0f, r);
+#else
+    if (u == 0.0f) return 0.0f;
+    if (u == 1.0f) return 1.0f;
+    if ((u*=2.0f) < 1.0f) return (0.5f*EASINGS_EXP2F(10.0f*(u - 1.0f)));
+
+    return (0.5f*(-EASINGS_EXP2F(-10.0f*(u - 1.0f)) + 2.0f));
+#endif
+}
+
+// Back Easing curves
+EASEDEF float EaseBackInU(float u)
 {
     float s = 1.70158f;
-    t = t/d - 1.0f;
-    return (c*(t*t*((s + 1.0f)*t + s) + 1.0f) + b);
+    return (u*u*((s + 1.0f)*u - s));
 }
 
-EASEDEF float EaseBackInOut(float t, float b, float c, float d)
+EASEDEF float EaseBackOutU(float u)
 {
     float s = 1.70158f;
-    if ((t/=d/2.0f) < 1.0f)
-    {
-        s *= 1.525f;
-        return (c/2.0f*(t*t*((s + 1.0f)*t - s)) + b);
-    }
+    u -= 1.0f;
+    return (u*u*((s + 1.0f)*u + s) + 1.0f);
+}
+
+EASEDEF float EaseBackInOutU(float u)
+{
+#if defined(EASINGS_BRANCHLESS)
+    float s = 1.70158f*1.525f;
+    int first = ((u*=2.0f) < 1.0f);
+    u -= EaseSelectf(first, 0.0f, 2.0f);
+    float r = u*u*((s + 1.0f)*u + EaseSelectf(first, -s, s));
 
-    float postFix = t-=2.0f;
-    s *= 1.525f;
-    return (c/2.0f*((postFix)*t*((s + 1.0f)*t + s) + 2.0f) + b);
+    return (0.5f*EaseSelectf(first, r, r + 2.0f));
+#else
+    float s = 1.70158f*1.525f;
+    if ((u*=2.0f) < 1.0f) return (0.5f*(u*u*((s + 1.0f)*u - s)));
+
+    u -= 2.0f;
+    return (0.5f*(u*u*((s + 1.0f)*u + s) + 2.0f));
+#endif
 }
 
-// Bounce Easing functions
-EASEDEF float EaseBounceOut(float t, float b, float c, float d)
+// Bounce Easing curves
+EASEDEF float EaseBounceOutU(float u)
 {
-    if ((t/=d) < (1.0f/2.75f))
+#if defined(EASINGS_BRANCHLESS)
+    // Pick the parabola offset and height of each bounce, from the last one backwards
+    // NOTE: (2.5f/2.75f) rounds up, so u < (2.5f/2.75f) matches the u < (2.5/2.75) of the branchy form
+    int second = (u < (2.5f/2.75f));
+    int third = (u < (2.0f/2.75f));
+    int fourth = (u < (1.0f/2.75f));
+    float offset = EaseSelectf(second, 2.25f/2.75f, 2.625f/2.75f);
+    float height = EaseSelectf(second, 0.9375f, 0.984375f);
+    offset = EaseSelectf(third, 1.5f/2.75f, offset);
+    height = EaseSelectf(third, 0.75f, height);
+    offset = EaseSelectf(fourth, 0.0f, offset);
+    height = EaseSelectf(fourth, 0.0f, height);
+
+    u -= offset;
+    return (7.5625f*u*u + height);
+#else
+    if (u < (1.0f/2.75f))
     {
-        return (c*(7.5625f*t*t) + b);
+        return (7.5625f*u*u);
     }
-    else if (t < (2.0f/2.75f))
+    else if (u < (2.0f/2.75f))
     {
-        float postFix = t-=(1.5f/2.75f);
-        return (c*(7.5625f*(postFix)*t + 0.75f) + b);
+        u -= (1.5f/2.75f);
+        return (7.5625f*u*u + 0.75f);
     }
-    else if (t < (2.5/2.75))
+    else if (u < (2.5/2.75))
     {
-        float postFix = t-=(2.25f/2.75f);
-        return (c*(7.5625f*(postFix)*t + 0.9375f) + b);
+        u -= (2.25f/2.75f);
+        return (7.5625f*u*u + 0.9375f);
     }
     else
     {
-        float postFix = t-=(2.625f/2.75f);
-        return (c*(7.5625f*(postFix)*t + 0.984375f) + b);
+        u -= (2.625f/2.75f);
+        return (7.5625f*u*u + 0.984375f);
     }
+#endif
 }
 
-EASEDEF float EaseBounceIn(float t, float b, float c, float d) { return (c - EaseBounceOut(d - t, 0.0f, c, d) + b); }
-EASEDEF float EaseBounceInOut(float t, float b, float c, float d)
+EASEDEF float EaseBounceInU(float u) { return (1.0f - EaseBounceOutU(1.0f - u)); }
+EASEDEF float EaseBounceInOutU(float u)
 {
-    if (t < d/2.0f) return (EaseBounceIn(t*2.0f, 0.0f, c, d)*0.5f + b);
-    else return (EaseBounceOut(t*2.0f - d, 0.0f, c, d)*0.5f + c*0.5f + b);
+#if defined(EASINGS_BRANCHLESS)
+    // NOTE: The first half is EaseBounceInU(u*2.0f) = 1.0f - EaseBounceOutU(1.0f - u*2.0f)
+    int first = (u < 0.5f);
+    float o = EaseBounceOutU(EaseSelectf(first, 1.0f - u*2.0f, u*2.0f - 1.0f));
+
+    return EaseSelectf(first, (1.0f - o)*0.5f, o*0.5f + 0.5f);
+#else
+    if (u < 0.5f) return (EaseBounceInU(u*2.0f)*0.5f);
+    else return (EaseBounceOutU(u*2.0f - 1.0f)*0.5f + 0.5f);
+#endif
 }
 
-// Elastic Easing functions
-EASEDEF float EaseElasticIn(float t, float b, float c, float d)
+// Elastic Easing curves
+EASEDEF float EaseElasticInU(float u)
 {
-    if (t == 0.0f) return b;
-    if ((t/=d) == 1.0f) return (b + c);
+#if defined(EASINGS_BRANCHLESS)
+    float p = 0.3f;
+    float s = p/4.0f;
+    float v = u - 1.0f;
+    float r = -(EASINGS_EXP2F(10.0f*v)*EASINGS_SINF((v - s)*(2.0f*PI)/p));
 
-    float p = d*0.3f;
-    float a = c;
+    r = EaseSelectf(u == 1.0f, 1.0f, r);
+
+    return EaseSelectf(u == 0.0f, 0.0f, r);
+#else
+    if (u == 0.0f) return 0.0f;
+    if (u == 1.0f) return 1.0f;
+
+    float p = 0.3f;
     float s = p/4.0f;
-    float postFix = a*powf(2.0f, 10.0f*(t-=1.0f));
+    u -= 1.0f;
 
-    return (-(postFix*sinf((t*d-s)*(2.0f*PI)/p )) + b);
+    return (-(EASINGS_EXP2F(10.0f*u)*EASINGS_SINF((u - s)*(2.0f*PI)/p)));
+#endif
 }
 
-EASEDEF float EaseElasticOut(float t, float b, float c, float d)
+EASEDEF float EaseElasticOutU(float u)
 {
-    if (t == 0.0f) return b;
-    if ((t/=d) == 1.0f) return (b + c);
+#if defined(EASINGS_BRANCHLESS)
+    float p = 0.3f;
+    float s = p/4.0f;
+    float r = EASINGS_EXP2F(-10.0f*u)*EASINGS_SINF((u - s)*(2.0f*PI)/p) + 1.0f;
+
+    r = EaseSelectf(u == 1.0f, 1.0f, r);
+
+    return EaseSelectf(u == 0.0f, 0.0f, r);
+#else
+    if (u == 0.0f) return 0.0f;
+    if (u == 1.0f) return 1.0f;
 
-    float p = d*0.3f;
-    float a = c;
+    float p = 0.3f;
     float s = p/4.0f;
 
-    return (a*powf(2.0f,-10.0f*t)*sinf((t*d-s)*(2.0f*PI)/p) + c + b);
+    return (EASINGS_EXP2F(-10.0f*u)*EASINGS_SINF((u - s)*(2.0f*PI)/p) + 1.0f);
+#endif
 }
 
-EASEDEF float EaseElasticInOut(float t, float b, float c, float d)
+EASEDEF float EaseElasticInOutU(float u)
 {
-    if (t == 0.0f) return b;
-    if ((t/=d/2.0f) == 2.0f) return (b + c);
+#if defined(EASINGS_BRANCHLESS)
+    float p = 0.3f*1.5f;
+    float s = p/4.0f;
+    float u2 = u*2.0f;
+    int first = (u2 < 1.0f);
+    float v = u2 - 1.0f;
+
+    // NOTE: -0.5f*(e*sn) is exactly -((e*sn)*0.5f)
+    float h = EASINGS_EXP2F(EaseSelectf(first, 10.0f*v, -10.0f*v))*EASINGS_SINF((v - s)*(2.0f*PI)/p)*0.5f;
+    float r = EaseSelectf(first, -h, h + 1.0f);
+
+    r = EaseSelectf(u2 == 2.0f, 1.0f, r);
 
-    float p = d*(0.3f*1.5f);
-    float a = c;
+    return EaseSelectf(u == 0.0f, 0.0f, r);
+#else
+    if (u == 0.0f) return 0.0f;
+    if ((u*=2.0f) == 2.0f) return 1.0f;
+
+    float p = 0.3f*1.5f;
     float s = p/4.0f;
 
-    if (t < 1.0f)
+    if (u < 1.0f)
     {
-        float postFix = a*powf(2.0f, 10.0f*(t-=1.0f));
-        return -0.5f*(postFix*sinf((t*d-s)*(2.0f*PI)/p)) + b;
+        u -= 1.0f;
+        return -0.5f*(EASINGS_EXP2F(10.0f*u)*EASINGS_SINF((u - s)*(2.0f*PI)/p));
     }
 
-    float postFix = a*powf(2.0f, -10.0f*(t-=1.0f));
+    u -= 1.0f;
 
-    return (postFix*sinf((t*d-s)*(2.0f*PI)/p)*0.5f + c + b);
+    return (EASINGS_EXP2F(-10.0f*u)*EASINGS_SINF((u - s)*(2.0f*PI)/p)*0.5f + 1.0f);
+#endif
 }
 
-#ifdef __cplusplus
+// Linear Easing functions
+EASEDEF float EaseLinearNone(float t, float b, float c, float d) { return (c*EaseLinearNoneU(t/d) + b); }
+EASEDEF float EaseLinearIn(float t, float b, float c, float d) { return (c*EaseLinearInU(t/d) + b); }
+EASEDEF float EaseLinearOut(float t, float b, float c, float d) { return (c*EaseLinearOutU(t/d) + b); }
+EASEDEF float EaseLinearInOut(float t,float b, float c, float d) { return (c*EaseLinearInOutU(t/d) + b); }
+
+// Sine Easing functions
+EASEDEF float EaseSineIn(float t, float b, float c, float d) { return (c*EaseSineInU(t/d) + b); }
+EASEDEF float EaseSineOut(float t, float b, float c, float d) { return (c*EaseSineOutU(t/d) + b); }
+EASEDEF float EaseSineInOut(float t, float b, float c, float d) { return (c*EaseSineInOutU(t/d) + b); }
+
+// Circular Easing functions
+EASEDEF float EaseCircIn(float t, float b, float c, float d) { return (c*EaseCircInU(t/d) + b); }
+EASEDEF float EaseCircOut(float t, float b, float c, float d) { return (c*EaseCircOutU(t/d) + b); }
+EASEDEF float EaseCircInOut(float t, float b, float c, float d) { return (c*EaseCircInOutU(t/d) + b); }
+
+// Cubic Easing functions
+EASEDEF float EaseCubicIn(float t, float b, float c, float d) { return (c*EaseCubicInU(t/d) + b); }
+EASEDEF float EaseCubicOut(float t, float b, float c, float d) { return (c*EaseCubicOutU(t/d) + b); }
+EASEDEF float EaseCubicInOut(float t, float b, float c, float d) { return (c*EaseCubicInOutU(t/d) + b); }
+
+// Quadratic Easing functions
+EASEDEF float EaseQuadIn(float t, float b, float c, float d) { return (c*EaseQuadInU(t/d) + b); }
+EASEDEF float EaseQuadOut(float t, float b, float c, float d) { return (c*EaseQuadOutU(t/d) + b); }
+EASEDEF float EaseQuadInOut(float t, float b, float c, float d) { return (c*EaseQuadInOutU(t/d) + b); }
+
+// Exponential Easing functions
+EASEDEF float EaseExpoIn(float t, float b, float c, float d) { return (c*EaseExpoInU(t/d) + b); }
+EASEDEF float EaseExpoOut(float t, float b, float c, float d) { return (c*EaseExpoOutU(t/d) + b); }
+EASEDEF float EaseExpoInOut(float t, float b, float c, float d) { return (c*EaseExpoInOutU(t/d) + b); }
+
+// Back Easing functions
+EASEDEF float EaseBackIn(float t, float b, float c, float d) { return (c*EaseBackInU(t/d) + b); }
+EASEDEF float EaseBackOut(float t, float b, float c, float d) { return (c*EaseBackOutU(t/d) + b); }
+EASEDEF float EaseBackInOut(float t, float b, float c, float d) { return (c*EaseBackInOutU(t/d) + b); }
+
+// Bounce Easing functions
+EASEDEF float EaseBounceOut(float t, float b, float c, float d) { return (c*EaseBounceOutU(t/d) + b); }
+EASEDEF float EaseBounceIn(float t, float b, float c, float d) { return (c*EaseBounceInU(t/d) + b); }
+EASEDEF float EaseBounceInOut(float t, float b, float c, float d) { return (c*EaseBounceInOutU(t/d) + b); }
+
+// Elastic Easing functions
+EASEDEF float EaseElasticIn(float t, float b, float c, float d) { return (c*EaseElasticInU(t/d) + b); }
+EASEDEF float EaseElasticOut(float t, float b, float c, float d) { return (c*EaseElasticOutU(t/d) + b); }
+EASEDEF float EaseElasticInOut(float t, float b, float c, float d) { return (c*EaseElasticInOutU(t/d) + b); }
+
+// Linear Easing derivatives
+EASEDEF float EaseLinearNoneDerivU(float u) { (void)u; return 1.0f; }
+EASEDEF float EaseLinearInDerivU(float u) { (void)u; return 1.0f; }
+EASEDEF float EaseLinearOutDerivU(float u) { (void)u; return 1.0f; }
+EASEDEF float EaseLinearInOutDerivU(float u) { (void)u; return 1.0f; }
+
+EASEDEF float EaseLinearNoneFusedU(float u, float *derivU) { *derivU = 1.0f; return u; }
+EASEDEF float EaseLinearInFusedU(float u, float *derivU) { *derivU = 1.0f; return u; }
+EASEDEF float EaseLinearOutFusedU(float u, float *derivU) { *derivU = 1.0f; return u; }
+EASEDEF float EaseLinearInOutFusedU(float u, float *derivU) { *derivU = 1.0f; return u; }
+
+// Sine Easing derivatives
+EASEDEF float EaseSineInDerivU(float u) { return ((PI/2.0f)*EASINGS_SINF(u*(PI/2.0f))); }
+EASEDEF float EaseSineOutDerivU(float u) { return ((PI/2.0f)*EASINGS_COSF(u*(PI/2.0f))); }
+EASEDEF float EaseSineInOutDerivU(float u) { return (0.5f*PI*EASINGS_SINF(PI*u)); }
+
+EASEDEF float EaseSineInFusedU(float u, float *derivU)
+{
+    float a = u*(PI/2.0f);
+    *derivU = (PI/2.0f)*EASINGS_SINF(a);
+    return (1.0f - EASINGS_COSF(a));
 }
-#endif
+
+EASEDEF float EaseSineOutFusedU(float u, float *derivU)
+{
+    float a = u*(PI/2.0f);
+    *derivU = (PI/2.0f)*EASINGS_COSF(a);
+    return EASINGS_SINF(a);
+}
+
+EASEDEF float EaseSineInOutFusedU(float u, float *derivU)
+{
+    float a = PI*u;
+    *derivU = 0.5f*PI*EASINGS_SINF(a);
+    return (-0.5f*(EASINGS_COSF(a) - 1.0f));
+}
+
+// Circular Easing derivatives
+EASEDEF float EaseCircInDerivU(float u) { return (u/sqrtf(1.0f - u*u)); }
+EASEDEF float EaseCircOutDerivU(float u) { u -= 1.0f; return (-u/sqrtf(1.0f - u*u)); }
+EASEDEF float EaseCircInOutDerivU(float u)
+{
+    if ((u*=2.0f) < 1.0f) return (u/sqrtf(1.0f - u*u));
+    u -= 2.0f; return (-u/sqrtf(1.0f - u*u));
+}
+
+EASEDEF float EaseCircInFusedU(float u, float *derivU)
+{
+    float sq = sqrtf(1.0f - u*u);
+    *derivU = u/sq;
+    return (1.0f - sq);
+}
+
+EASEDEF float EaseCircOutFusedU(float u, float *derivU)
+{
+    u -= 1.0f;
+    float sq = sqrtf(1.0f - u*u);
+    *derivU = -u/sq;
+    return sq;
+}
+
+EASEDEF float EaseCircInOutFusedU(float u, float *derivU)
+{
+    if ((u*=2.0f) < 1.0f)
+    {
+        float sq = sqrtf(1.0f - u*u);
+        *derivU = u/sq;
+        return (-0.5f*(sq - 1.0f));
+    }
+
+    u -= 2.0f;
+    float sq = sqrtf(1.0f - u*u);
+    *derivU = -u/sq;
+    return (0.5f*(sq + 1.0f));
+}
+
+// Cubic Easing derivatives
+EASEDEF float EaseCubicInDerivU(float u) { return (3.0f*u*u); }
+EASEDEF float EaseCubicOutDerivU(float u) { u -= 1.0f; return (3.0f*u*u); }
+EASEDEF float EaseCubicInOutDerivU(float u)
+{
+    if ((u*=2.0f) < 1.0f) return (3.0f*u*u);
+    u -= 2.0f; return (3.0f*u*u);
+}
+
+EASEDEF float EaseCubicInFusedU(float u, float *derivU) { *derivU = 3.0f*u*u; return (u*u*u); }
+EASEDEF float EaseCubicOutFusedU(float u, float *derivU) { u -= 1.0f; *derivU = 3.0f*u*u; return (u*u*u + 1.0f); }
+EASEDEF float EaseCubicInOutFusedU(float u, float *derivU)
+{
+    if ((u*=2.0f) < 1.0f) { *derivU = 3.0f*u*u; return (0.5f*u*u*u); }
+    u -= 2.0f; *derivU = 3.0f*u*u; return (0.5f*(u*u*u + 2.0f));
+}
+
+// Quadratic Easing derivatives
+EASEDEF float EaseQuadInDerivU(float u) { return (2.0f*u); }
+EASEDEF float EaseQuadOutDerivU(float u) { return (-2.0f*(u - 1.0f)); }
+EASEDEF float EaseQuadInOutDerivU(float u)
+{
+    if ((u*=2.0f) < 1.0f) return (2.0f*u);
+    return (-2.0f*(u - 2.0f));
+}
+
+EASEDEF float EaseQuadInFusedU(float u, float *derivU) { *derivU = 2.0f*u; return (u*u); }
+EASEDEF float EaseQuadOutFusedU(float u, float *derivU) { *derivU = -2.0f*(u - 1.0f); return (-u*(u - 2.0f)); }
+EASEDEF float EaseQuadInOutFusedU(float u, float *derivU)
+{
+    if ((u*=2.0f) < 1.0f) { *derivU = 2.0f*u; return (0.5f*(u*u)); }
+    *derivU = -2.0f*(u - 2.0f); return (-0.5f*(((u - 1.0f)*(u - 3.0f)) - 1.0f));
+}
+
+// Exponential Easing derivatives
+EASEDEF float EaseExpoInDerivU(float u) { return (10.0f*EASINGS_LN2*EASINGS_EXP2F(10.0f*(u - 1.0f))); }
+EASEDEF float EaseExpoOutDerivU(float u) { return (10.0f*EASINGS_LN2*EASINGS_EXP2F(-10.0f*u)); }
+EASEDEF float EaseExpoInOutDerivU(float u)
+{
+    if ((u*=2.0f) < 1.0f) return (10.0f*EASINGS_LN2*EASINGS_EXP2F(10.0f*(u - 1.0f)));
+    return (10.0f*EASINGS_LN2*EASINGS_EXP2F(-10.0f*(u - 1.0f)));
+}
+
+EASEDEF float EaseExpoInFusedU(float u, float *derivU)
+{
+    float e = EASINGS_EXP2F(10.0f*(u - 1.0f));
+    *derivU = 10.0f*EASINGS_LN2*e;
+    return (u == 0.0f) ? 0.0f : e;
+}
+
+EASEDEF float EaseExpoOutFusedU(float u, float *derivU)
+{
+    float e = EASINGS_EXP2F(-10.0f*u);
+    *derivU = 10.0f*EASINGS_LN2*e;
+    return (u == 1.0f) ? 1.0f : (-e + 1.0f);
+}
+
+EASEDEF float EaseExpoInOutFusedU(float u, float *derivU)
+{
+    float u2 = u*2.0f;
+
+    if (u2 < 1.0f)
+    {
+        float e = EASINGS_EXP2F(10.0f*(u2 - 1.0f));
+        *derivU = 10.0f*EASINGS_LN2*e;
+        return (u == 0.0f) ? 0.0f : (0.5f*e);
+    }
+
+    float e = EASINGS_EXP2F(-10.0f*(u2 - 1.0f));
+    *derivU = 10.0f*EASINGS_LN2*e;
+    return (u == 1.0f) ? 1.0f : (0.5f*(-e + 2.0f));
+}
+
+// Back Easing derivatives
+EASEDEF float EaseBackInDerivU(float u)
+{
+    float s = 1.70158f;
+    return (u*(3.0f*(s + 1.0f)*u - 2.0f*s));
+}
+
+EASEDEF float EaseBackOutDerivU(float u)
+{
+    float s = 1.70158f;
+    u -= 1.0f;
+    return (u*(3.0f*(s + 1.0f)*u + 2.0f*s));
+}
+
+EASEDEF float EaseBackInOutDerivU(float u)
+{
+    float s = 1.70158f*1.525f;
+    if ((u*=2.0f) < 1.0f) return (u*(3.0f*(s + 1.0f)*u - 2.0f*s));
+
+    u -= 2.0f;
+    return (u*(3.0f*(s + 1.0f)*u + 2.0f*s));
+}
+
+EASEDEF float EaseBackInFusedU(float u, float *derivU)
+{
+    float s = 1.70158f;
+    *derivU = u*(3.0f*(s + 1.0f)*u - 2.0f*s);
+    return (u*u*((s + 1.0f)*u - s));
+}
+
+EASEDEF float EaseBackOutFusedU(float u, float *derivU)
+{
+    float s = 1.70158f;
+    u -= 1.0f;
+    *derivU = u*(3.0f*(s + 1.0f)*u + 2.0f*s);
+    return (u*u*((s + 1.0f)*u + s) + 1.0f);
+}
+
+EASEDEF float EaseBackInOutFusedU(float u, float *derivU)
+{
+    float s = 1.70158f*1.525f;
+    if ((u*=2.0f) < 1.0f)
+    {
+        *derivU = u*(3.0f*(s + 1.0f)*u - 2.0f*s);
+        return (0.5f*(u*u*((s + 1.0f)*u - s)));
+    }
+
+    u -= 2.0f;
+    *derivU = u*(3.0f*(s + 1.0f)*u + 2.0f*s);
+    return (0.5f*(u*u*((s + 1.0f)*u + s) + 2.0f));
+}
+
+// Bounce Easing derivatives
+EASEDEF float EaseBounceOutDerivU(float u)
+{
+    if (u < (1.0f/2.75f)) return (15.125f*u);
+    else if (u < (2.0f/2.75f)) return (15.125f*(u - (1.5f/2.75f)));
+    else if (u < (2.5f/2.75f)) return (15.125f*(u - (2.25f/2.75f)));
+    else return (15.125f*(u - (2.625f/2.75f)));
+}
+
+EASEDEF float EaseBounceInDerivU(float u) { return EaseBounceOutDerivU(1.0f - u); }
+EASEDEF float EaseBounceInOutDerivU(float u)
+{
+    if (u < 0.5f) return EaseBounceInDerivU(u*2.0f);
+    else return EaseBounceOutDerivU(u*2.0f - 1.0f);
+}
+
+EASEDEF float EaseBounceOutFusedU(float u, float *derivU)
+{
+    // Parabola offset and height of the bounce u is in, 0 for the first one
+    float offset = 0.0f;
+    float height = 0.0f;
+
+    if (u >= (2.5f/2.75f))
+    {
+        offset = (2.625f/2.75f);
+        height = 0.984375f;
+    }
+    else if (u >= (2.0f/2.75f))
+    {
+        offset = (2.25f/2.75f);
+        height = 0.9375f;
+    }
+    else if (u >= (1.0f/2.75f))
+    {
+        offset = (1.5f/2.75f);
+        height = 0.75f;
+    }
+
+    u -= offset;
+    *derivU = 15.125f*u;
+    return (7.5625f*u*u + height);
+}
+
+EASEDEF float EaseBounceInFusedU(float u, float *derivU) { return (1.0f - EaseBounceOutFusedU(1.0f - u, derivU)); }
+EASEDEF float EaseBounceInOutFusedU(float u, float *derivU)
+{
+    if (u < 0.5f) return (EaseBounceInFusedU(u*2.0f, derivU)*0.5f);
+    else return (EaseBounceOutFusedU(u*2.0f - 1.0f, derivU)*0.5f + 0.5f);
+}
+
+// Elastic Easing derivatives
+EASEDEF float EaseElasticInFusedU(float u, float *derivU)
+{
+    float p = 0.3f;
+    float s = p/4.0f;
+    float w = (2.0f*PI)/p;
+    float v = u - 1.0f;
+    float e = EASINGS_EXP2F(10.0f*v);
+    float a = (v - s)*(2.0f*PI)/p;
+    float sn = EASINGS_SINF(a);
+
+    *derivU = -(e*(10.0f*EASINGS_LN2*sn + w*EASINGS_COSF(a)));
+
+    if (u == 0.0f) return 0.0f;
+    if (u == 1.0f) return 1.0f;
+
+    return (-(e*sn));
+}
+
+EASEDEF float EaseElasticOutFusedU(float u, float *derivU)
+{
+    float p = 0.3f;
+    float s = p/4.0f;
+    float w = (2.0f*PI)/p;
+    float e = EASINGS_EXP2F(-10.0f*u);
+    float a = (u - s)*(2.0f*PI)/p;
+    float sn = EASINGS_SINF(a);
+
+    *derivU = e*(-10.0f*EASINGS_LN2*sn + w*EASINGS_COSF(a));
+
+    if (u == 0.0f) return 0.0f;
+    if (u == 1.0f) return 1.0f;
+
+    return (e*sn + 1.0f);
+}
+
+EASEDEF float EaseElasticInOutFusedU(float u, float *derivU)
+{
+    float p = 0.3f*1.5f;
+    float s = p/4.0f;
+    float w = (2.0f*PI)/p;
+    float u2 = u*2.0f;
+    float v = u2 - 1.0f;
+    int first = (u2 < 1.0f);
+    float e = EASINGS_EXP2F(first? 10.0f*v : -10.0f*v);
+    float a = (v - s)*(2.0f*PI)/p;
+    float sn = EASINGS_SINF(a);
+    float cs = EASINGS_COSF(a);
+
+    // NOTE: Each half is scaled by 0.5f and u2 runs twice as fast as u, so they cancel out
+    if (first)
+    {
+        *derivU = -(e*(10.0f*EASINGS_LN2*sn + w*cs));
+        return (u == 0.0f) ? 0.0f : -0.5f*(e*sn);
+    }
+
+    *derivU = e*(-10.0f*EASINGS_LN2*sn + w*cs);
+    return (u2 == 2.0f) ? 1.0f : (e*sn*0.5f + 1.0f);
+}
+
+EASEDEF float EaseElasticInDerivU(float u) { float derivU; EaseElasticInFusedU(u, &derivU); return derivU; }
+EASEDEF float EaseElasticOutDerivU(float u) { float derivU; EaseElasticOutFusedU(u, &derivU); return derivU; }
+EASEDEF float EaseElasticInOutDerivU(float u) { float derivU; EaseElasticInOutFusedU(u, &derivU); return derivU; }
+
+// Derivatives over t of the Penner functions
+#define EASINGS_DERIV_DEFINE(func) \
+    EASEDEF float func##Deriv(float t, float b, float c, float d) \
+    { \
+        (void)b; \
+        return (c*func##DerivU(t/d)/d); \
+    } \
+    EASEDEF float func##Fused(float t, float b, float c, float d, float *velocity) \
+    { \
+        float derivU; \
+        float value = c*func##FusedU(t/d, &derivU) + b; \
+        *velocity = c*derivU/d; \
+        return value; \
+    }
+
+EASINGS_DERIV_DEFINE(EaseLinearNone)
+EASINGS_DERIV_DEFINE(EaseLinearIn)
+EASINGS_DERIV_DEFINE(EaseLinearOut)
+EASINGS_DERIV_DEFINE(EaseLinearInOut)
+
+EASINGS_DERIV_DEFINE(EaseSineIn)
+EASINGS_DERIV_DEFINE(EaseSineOut)
+EASINGS_DERIV_DEFINE(EaseSineInOut)
+
+EASINGS_DERIV_DEFINE(EaseCircIn)
+EASINGS_DERIV_DEFINE(EaseCircOut)
+EASINGS_DERIV_DEFINE(EaseCircInOut)
+
+EASINGS_DERIV_DEFINE(EaseCubicIn)
+EASINGS_DERIV_DEFINE(EaseCubicOut)
+EASINGS_DERIV_DEFINE(EaseCubicInOut)
+
+EASINGS_DERIV_DEFINE(EaseQuadIn)
+EASINGS_DERIV_DEFINE(EaseQuadOut)
+EASINGS_DERIV_DEFINE(EaseQuadInOut)
+
+EASINGS_DERIV_DEFINE(EaseExpoIn)
+EASINGS_DERIV_DEFINE(EaseExpoOut)
+EASINGS_DERIV_DEFINE(EaseExpoInOut)
+
+EASINGS_DERIV_DEFINE(EaseBackIn)
+EASINGS_DERIV_DEFINE(EaseBackOut)
+EASINGS_DERIV_DEFINE(EaseBackInOut)
+
+EASINGS_DERIV_DEFINE(EaseBounceOut)
+EASINGS_DERIV_DEFINE(EaseBounceIn)
+EASINGS_DERIV_DEFINE(EaseBounceInOut)
+
+EASINGS_DERIV_DEFINE(EaseElasticIn)
+EASINGS_DERIV_DEFINE(EaseElasticOut)
+EASINGS_DERIV_DEFINE(EaseElasticInOut)
+
+EASEDEF float EaseCurveDerivU(EaseType type, float u)
+{
+    switch (type)
+    {
+        case EASE_TYPE_LINEAR_NONE: return EaseLinearNoneDerivU(u);
+        case EASE_TYPE_LINEAR_IN: return EaseLinearInDerivU(u);
+        case EASE_TYPE_LINEAR_OUT: return EaseLinearOutDerivU(u);
+        case EASE_TYPE_LINEAR_IN_OUT: return EaseLinearInOutDerivU(u);
+        case EASE_TYPE_SINE_IN: return EaseSineInDerivU(u);
+        case EASE_TYPE_SINE_OUT: return EaseSineOutDerivU(u);
+        case EASE_TYPE_SINE_IN_OUT: return EaseSineInOutDerivU(u);
+        case EASE_TYPE_CIRC_IN: return EaseCircInDerivU(u);
+        case EASE_TYPE_CIRC_OUT: return EaseCircOutDerivU(u);
+        case EASE_TYPE_CIRC_IN_OUT: return EaseCircInOutDerivU(u);
+        case EASE_TYPE_CUBIC_IN: return EaseCubicInDerivU(u);
+        case EASE_TYPE_CUBIC_OUT: return EaseCubicOutDerivU(u);
+        case EASE_TYPE_CUBIC_IN_OUT: return EaseCubicInOutDerivU(u);
+        case EASE_TYPE_QUAD_IN: return EaseQuadInDerivU(u);
+        case EASE_TYPE_QUAD_OUT: return EaseQuadOutDerivU(u);
+        case EASE_TYPE_QUAD_IN_OUT: return EaseQuadInOutDerivU(u);
+        case EASE_TYPE_EXPO_IN: return EaseExpoInDerivU(u);
+        case EASE_TYPE_EXPO_OUT: return EaseExpoOutDerivU(u);
+        case EASE_TYPE_EXPO_IN_OUT: return EaseExpoInOutDerivU(u);
+        case EASE_TYPE_BACK_IN: return EaseBackInDerivU(u);
+        case EASE_TYPE_BACK_OUT: return EaseBackOutDerivU(u);
+        case EASE_TYPE_BACK_IN_OUT: return EaseBackInOutDerivU(u);
+        case EASE_TYPE_BOUNCE_OUT: return EaseBounceOutDerivU(u);
+        case EASE_TYPE_BOUNCE_IN: return EaseBounceInDerivU(u);
+        case EASE_TYPE_BOUNCE_IN_OUT: return EaseBounceInOutDerivU(u);
+        case EASE_TYPE_ELASTIC_IN: return EaseElasticInDerivU(u);
+        case EASE_TYPE_ELASTIC_OUT: return EaseElasticOutDerivU(u);
+        case EASE_TYPE_ELASTIC_IN_OUT: return EaseElasticInOutDerivU(u);
+        default: return 0.0f;
+    }
+}
+
+EASEDEF float EaseCurveFusedU(EaseType type, float u, float *derivU)
+{
+    switch (type)
+    {
+        case EASE_TYPE_LINEAR_NONE: return EaseLinearNoneFusedU(u, derivU);
+        case EASE_TYPE_LINEAR_IN: return EaseLinearInFusedU(u, derivU);
+        case EASE_TYPE_LINEAR_OUT: return EaseLinearOutFusedU(u, derivU);
+        case EASE_TYPE_LINEAR_IN_OUT: return EaseLinearInOutFusedU(u, derivU);
+        case EASE_TYPE_SINE_IN: return EaseSineInFusedU(u, derivU);
+        case EASE_TYPE_SINE_OUT: return EaseSineOutFusedU(u, derivU);
+        case EASE_TYPE_SINE_IN_OUT: return EaseSineInOutFusedU(u, derivU);
+        case EASE_TYPE_CIRC_IN: return EaseCircInFusedU(u, derivU);
+        case EASE_TYPE_CIRC_OUT: return EaseCircOutFusedU(u, derivU);
+        case EASE_TYPE_CIRC_IN_OUT: return EaseCircInOutFusedU(u, derivU);
+        case EASE_TYPE_CUBIC_IN: return EaseCubicInFusedU(u, derivU);
+        case EASE_TYPE_CUBIC_OUT: return EaseCubicOutFusedU(u, derivU);
+        case EASE_TYPE_CUBIC_IN_OUT: return EaseCubicInOutFusedU(u, derivU);
+        case EASE_TYPE_QUAD_IN: return EaseQuadInFusedU(u, derivU);
+        case EASE_TYPE_QUAD_OUT: return EaseQuadOutFusedU(u, derivU);
+        case EASE_TYPE_QUAD_IN_OUT: return EaseQuadInOutFusedU(u, derivU);
+        case EASE_TYPE_EXPO_IN: return EaseExpoInFusedU(u, derivU);
+        case EASE_TYPE_EXPO_OUT: return EaseExpoOutFusedU(u, derivU);
+        case EASE_TYPE_EXPO_IN_OUT: return EaseExpoInOutFusedU(u, derivU);
+        case EASE_TYPE_BACK_IN: return EaseBackInFusedU(u, derivU);
+        case EASE_TYPE_BACK_OUT: return EaseBackOutFusedU(u, derivU);
+        case EASE_TYPE_BACK_IN_OUT: return EaseBackInOutFusedU(u, derivU);
+        case EASE_TYPE_BOUNCE_OUT: return EaseBounceOutFusedU(u, derivU);
+        case EASE_TYPE_BOUNCE_IN: return EaseBounceInFusedU(u, derivU);
+        case EASE_TYPE_BOUNCE_IN_OUT: return EaseBounceInOutFusedU(u, derivU);
+        case EASE_TYPE_ELASTIC_IN: return EaseElasticInFusedU(u, derivU);
+        case EASE_TYPE_ELASTIC_OUT: return EaseElasticOutFusedU(u, derivU);
+        case EASE_TYPE_ELASTIC_IN_OUT: return EaseElasticInOutFusedU(u, derivU);
+        default: *derivU = 0.0f; return 0.0f;
+    }
+}
+
+// Prepared Easing functions
+
+EASEDEF EasePrepared EasePrepare(EaseType type, float b, float c, float d)
+{
+    EasePrepared ease = { type, b, c, d, 1.0f/d };
+
+    return ease;
+}
+
+EASEDEF float EaseCurveU(EaseType type, float u)
+{
+    switch (type)
+    {
+        case EASE_TYPE_LINEAR_NONE: return EaseLinearNoneU(u);
+        case EASE_TYPE_LINEAR_IN: return EaseLinearInU(u);
+        case EASE_TYPE_LINEAR_OUT: return EaseLinearOutU(u);
+        case EASE_TYPE_LINEAR_IN_OUT: return EaseLinearInOutU(u);
+        case EASE_TYPE_SINE_IN: return EaseSineInU(u);
+        case EASE_TYPE_SINE_OUT: return EaseSineOutU(u);
+        case EASE_TYPE_SINE_IN_OUT: return EaseSineInOutU(u);
+        case EASE_TYPE_CIRC_IN: return EaseCircInU(u);
+        case EASE_TYPE_CIRC_OUT: return EaseCircOutU(u);
+        case EASE_TYPE_CIRC_IN_OUT: return EaseCircInOutU(u);
+        case EASE_TYPE_CUBIC_IN: return EaseCubicInU(u);
+        case EASE_TYPE_CUBIC_OUT: return EaseCubicOutU(u);
+        case EASE_TYPE_CUBIC_IN_OUT: return EaseCubicInOutU(u);
+        case EASE_TYPE_QUAD_IN: return EaseQuadInU(u);
+        case EASE_TYPE_QUAD_OUT: return EaseQuadOutU(u);
+        case EASE_TYPE_QUAD_IN_OUT: return EaseQuadInOutU(u);
+        case EASE_TYPE_EXPO_IN: return EaseExpoInU(u);
+        case EASE_TYPE_EXPO_OUT: return EaseExpoOutU(u);
+        case EASE_TYPE_EXPO_IN_OUT: return EaseExpoInOutU(u);
+        case EASE_TYPE_BACK_IN: return EaseBackInU(u);
+        case EASE_TYPE_BACK_OUT: return EaseBackOutU(u);
+        case EASE_TYPE_BACK_IN_OUT: return EaseBackInOutU(u);
+        case EASE_TYPE_BOUNCE_OUT: return EaseBounceOutU(u);
+        case EASE_TYPE_BOUNCE_IN: return EaseBounceInU(u);
+        case EASE_TYPE_BOUNCE_IN_OUT: return EaseBounceInOutU(u);
+        case EASE_TYPE_ELASTIC_IN: return EaseElasticInU(u);
+        case EASE_TYPE_ELASTIC_OUT: return EaseElasticOutU(u);
+        case EASE_TYPE_ELASTIC_IN_OUT: return EaseElasticInOutU(u);
+        default: return 0.0f;
+    }
+}
+
+EASEDEF float EasePreparedEval(const EasePrepared *ease, float t)
+{
+    float u = (t == ease->d)? 1.0f : t*ease->invD;
+
+    return (ease->c*EaseCurveU(ease->type, u) + ease->b);
+}
+
+// Vector Easing functions
+
+EASEDEF void EaseCurveUN(EaseType type, const float *EASINGS_RESTRICT u, float *EASINGS_RESTRICT out, size_t n)
+{
+    #define EASINGS_CURVE_CASE(name, func) case name: for (size_t i = 0; i < n; i++) out[i] = func(u[i]); break;
+
+    switch (type)
+    {
+        EASINGS_CURVE_CASE(EASE_TYPE_LINEAR_NONE, EaseLinearNoneU)
+        EASINGS_CURVE_CASE(EASE_TYPE_LINEAR_IN, EaseLinearInU)
+        EASINGS_CURVE_CASE(EASE_TYPE_LINEAR_OUT, EaseLinearOutU)
+        EASINGS_CURVE_CASE(EASE_TYPE_LINEAR_IN_OUT, EaseLinearInOutU)
+        EASINGS_CURVE_CASE(EASE_TYPE_SINE_IN, EaseSineInU)
+        EASINGS_CURVE_CASE(EASE_TYPE_SINE_OUT, EaseSineOutU)
+        EASINGS_CURVE_CASE(EASE_TYPE_SINE_IN_OUT, EaseSineInOutU)
+        EASINGS_CURVE_CASE(EASE_TYPE_CIRC_IN, EaseCircInU)
+        EASINGS_CURVE_CASE(EASE_TYPE_CIRC_OUT, EaseCircOutU)
+        EASINGS_CURVE_CASE(EASE_TYPE_CIRC_IN_OUT, EaseCircInOutU)
+        EASINGS_CURVE_CASE(EASE_TYPE_CUBIC_IN, EaseCubicInU)
+        EASINGS_CURVE_CASE(EASE_TYPE_CUBIC_OUT, EaseCubicOutU)
+        EASINGS_CURVE_CASE(EASE_TYPE_CUBIC_IN_OUT, EaseCubicInOutU)
+        EASINGS_CURVE_CASE(EASE_TYPE_QUAD_IN, EaseQuadInU)
+        EASINGS_CURVE_CASE(EASE_TYPE_QUAD_OUT, EaseQuadOutU)
+        EASINGS_CURVE_CASE(EASE_TYPE_QUAD_IN_OUT, EaseQuadInOutU)
+        EASINGS_CURVE_CASE(EASE_TYPE_EXPO_IN, EaseExpoInU)
+        EASINGS_CURVE_CASE(EASE_TYPE_EXPO_OUT, EaseExpoOutU)
+        EASINGS_CURVE_CASE(EASE_TYPE_EXPO_IN_OUT, EaseExpoInOutU)
+        EASINGS_CURVE_CASE(EASE_TYPE_BACK_IN, EaseBackInU)
+        EASINGS_CURVE_CASE(EASE_TYPE_BACK_OUT, EaseBackOutU)
+        EASINGS_CURVE_CASE(EASE_TYPE_BACK_IN_OUT, EaseBackInOutU)
+        EASINGS_CURVE_CASE(EASE_TYPE_BOUNCE_OUT, EaseBounceOutU)
+        EASINGS_CURVE_CASE(EASE_TYPE_BOUNCE_IN, EaseBounceInU)
+        EASINGS_CURVE_CASE(EASE_TYPE_BOUNCE_IN_OUT, EaseBounceInOutU)
+        EASINGS_CURVE_CASE(EASE_TYPE_ELASTIC_IN, EaseElasticInU)
+        EASINGS_CURVE_CASE(EASE_TYPE_ELASTIC_OUT, EaseElasticOutU)
+        EASINGS_CURVE_CASE(EASE_TYPE_ELASTIC_IN_OUT, EaseElasticInOutU)
+        default: for (size_t i = 0; i < n; i++) out[i] = 0.0f; break;
+    }
+
+    #undef EASINGS_CURVE_CASE
+}
+
+EASEDEF void EaseVector(EaseType type, float t, const float *EASINGS_RESTRICT b, const float *EASINGS_RESTRICT c, float d,
+                        float *EASINGS_RESTRICT out, int channels)
+{
+    float v = EaseCurveU(type, t/d);
+
+    for (int k = 0; k < channels; k++) out[k] = c[k]*v + b[k];
+}
+
+EASEDEF EaseVec2 EaseVector2(EaseType type, float t, EaseVec2 b, EaseVec2 c, float d)
+{
+    float v = EaseCurveU(type, t/d);
+    EaseVec2 result = { c.x*v + b.x, c.y*v + b.y };
+
+    return result;
+}
+
+EASEDEF EaseVec3 EaseVector3(EaseType type, float t, EaseVec3 b, EaseVec3 c, float d)
+{
+    float v = EaseCurveU(type, t/d);
+    EaseVec3 result = { c.x*v + b.x, c.y*v + b.y, c.z*v + b.z };
+
+    return result;
+}
+
+EASEDEF EaseVec4 EaseVector4(EaseType type, float t, EaseVec4 b, EaseVec4 c, float d)
+{
+    float v = EaseCurveU(type, t/d);
+    EaseVec4 result = { c.x*v + b.x, c.y*v + b.y, c.z*v + b.z, c.w*v + b.w };
+
+    return result;
+}
+
+EASEDEF EaseColor EaseColorBlend(EaseType type, float t, EaseColor start, EaseColor end, float d)
+{
+    float v = EaseCurveU(type, t/d);
+    float channels[4] = {
+        ((float)end.r - (float)start.r)*v + (float)start.r,
+        ((float)end.g - (float)start.g)*v + (float)start.g,
+        ((float)end.b - (float)start.b)*v + (float)start.b,
+        ((float)end.a - (float)start.a)*v + (float)start.a
+    };
+    unsigned char rgba[4];
+
+    for (int k = 0; k < 4; k++)
+    {
+        float x = channels[k] + 0.5f;
+
+        if (x < 0.0f) x = 0.0f;
+        if (x > 255.0f) x = 255.0f;
+
+        rgba[k] = (unsigned char)x;
+    }
+
+    EaseColor result = { rgba[0], rgba[1], rgba[2], rgba[3] };
+
+    return result;
+}
+
+EASEDEF void EaseVectorN(EaseType type, const float *EASINGS_RESTRICT t, float *EASINGS_RESTRICT out, size_t n, int channels,
+                         const float *EASINGS_RESTRICT b, const float *EASINGS_RESTRICT c, float d)
+{
+    float u[EASINGS_VECTOR_CHUNK];
+    float v[EASINGS_VECTOR_CHUNK];
+
+    for (size_t i = 0; i < n; i += EASINGS_VECTOR_CHUNK)
+    {
+        size_t m = (n - i < EASINGS_VECTOR_CHUNK)? n - i : EASINGS_VECTOR_CHUNK;
+
+        for (size_t j = 0; j < m; j++) u[j] = t[i + j]/d;
+        EaseCurveUN(type, u, v, m);
+
+        for (size_t j = 0; j < m; j++)
+        {
+            size_t base = (i + j)*channels;
+
+            for (int k = 0; k < channels; k++) out[base + k] = c[base + k]*v[j] + b[base + k];
+        }
+    }
+}
+
+EASEDEF void EaseVectorSoAN(EaseType type, const float *EASINGS_RESTRICT t, float *const *out, size_t n, int channels,
+                            const float *const *b, const float *const *c, float d)
+{
+    float u[EASINGS_VECTOR_CHUNK];
+    float v[EASINGS_VECTOR_CHUNK];
+
+    for (size_t i = 0; i < n; i += EASINGS_VECTOR_CHUNK)
+    {
+        size_t m = (n - i < EASINGS_VECTOR_CHUNK)? n - i : EASINGS_VECTOR_CHUNK;
+
+        for (size_t j = 0; j < m; j++) u[j] = t[i + j]/d;
+        EaseCurveUN(type, u, v, m);
+
+        for (int k = 0; k < channels; k++)
+        {
+            float *EASINGS_RESTRICT channelOut = out[k] + i;
+            const float *EASINGS_RESTRICT channelB = b[k] + i;
+            const float *EASINGS_RESTRICT channelC = c[k] + i;
+
+            for (size_t j = 0; j < m; j++) channelOut[j] = channelC[j]*v[j] + channelB[j];
+        }
+    }
+}
+
+// Dispatch Easing functions
+
+EASEDEF void EaseDispatchN(const EaseType *EASINGS_RESTRICT types, const float *EASINGS_RESTRICT t,
+                           float *EASINGS_RESTRICT out, size_t n, const float *EASINGS_RESTRICT b,
+                           const float *EASINGS_RESTRICT c, const float *EASINGS_RESTRICT d,
+                           uint32_t *EASINGS_RESTRICT order)
+{
+    size_t start[EASE_TYPE_COUNT + 1] = { 0 };
+    float u[EASINGS_VECTOR_CHUNK];
+    float v[EASINGS_VECTOR_CHUNK];
+
+    // Counting sort of the item indices by type
+    for (size_t i = 0; i < n; i++) if ((unsigned int)types[i] < EASE_TYPE_COUNT) start[types[i] + 1]++;
+    for (int type = 0; type < EASE_TYPE_COUNT; type++) start[type + 1] += start[type];
+
+    size_t next[EASE_TYPE_COUNT];
+    memcpy(next, start, sizeof(next));
+
+    for (size_t i = 0; i < n; i++) if ((unsigned int)types[i] < EASE_TYPE_COUNT) order[next[types[i]]++] = (uint32_t)i;
+
+    for (size_t i = 0; i < n; i++) out[i] = t[i]/d[i];
+
+    for (int type = 0; type < EASE_TYPE_COUNT; type++)
+    {
+        for (size_t i = start[type]; i < start[type + 1]; i += EASINGS_VECTOR_CHUNK)
+        {
+            size_t m = (start[type + 1] - i < EASINGS_VECTOR_CHUNK)? start[type + 1] - i : EASINGS_VECTOR_CHUNK;
+            const uint32_t *index = order + i;
+
+            for (size_t j = 0; j < m; j++) u[j] = out[index[j]];
+            EaseCurveUN((EaseType)type, u, v, m);
+            for (size_t j = 0; j < m; j++) out[index[j]] = v[j];
+        }
+    }
+
+    for (size_t i = 0; i < n; i++) out[i] = ((unsigned int)types[i] < EASE_TYPE_COUNT)? c[i]*out[i] + b[i] : b[i];
+}
+
+// Table Easing functions
+
+// Samples of every type, with one extra sample at each end for Catmull-Rom
+static float *easeTables[EASE_TYPE_COUNT] = { 0 };
+static int easeTableSize = EASINGS_TABLE_DEFAULT_SIZE;
+
+EASEDEF void EaseTableFree(void)
+{
+    for (int i = 0; i < EASE_TYPE_COUNT; i++)
+    {
+        free(easeTables[i]);
+        easeTables[i] = NULL;
+    }
+}
+
+EASEDEF void EaseTableSetSize(int size)
+{
+    if (size < EASINGS_TABLE_MIN_SIZE) size = EASINGS_TABLE_MIN_SIZE;
+    if (size > EASINGS_TABLE_MAX_SIZE) size = EASINGS_TABLE_MAX_SIZE;
+
+    if (size != easeTableSize)
+    {
+        EaseTableFree();
+        easeTableSize = size;
+    }
+}
+
+EASEDEF int EaseTableGetSize(void) { return easeTableSize; }
+
+EASEDEF const float *EaseTableGet(EaseType type)
+{
+    if ((unsigned int)type >= EASE_TYPE_COUNT) return NULL;
+
+    if (easeTables[type] == NULL)
+    {
+        int size = easeTableSize;
+        float *table = (float *)malloc((size + 2)*sizeof(float));
+
+        if (table == NULL) return NULL;
+
+        // NOTE: End samples are taken just inside [0, 1], Expo and Elastic jump to exactly 0.0f and 1.0f
+        // at the ends and interpolating towards that jump would spread it over the whole segment
+        table[1] = EaseCurveU(type, nextafterf(0.0f, 1.0f));
+        for (int i = 1; i < size - 1; i++) table[i + 1] = EaseCurveU(type, (float)i/(float)(size - 1));
+        table[size] = EaseCurveU(type, nextafterf(1.0f, 0.0f));
+
+        // Ends are extended linearly, so Catmull-Rom needs no special case on the first and last segments
+        table[0] = 2.0f*table[1] - table[2];
+        table[size + 1] = 2.0f*table[size] - table[size - 1];
+
+        easeTables[type] = table;
+    }
+
+    return easeTables[type] + 1;
+}
+
+EASEDEF float EaseTableU(EaseType type, float u, EaseTableInterp interp)
+{
+    const float *p = EaseTableGet(type);
+
+    if (p == NULL) return EaseCurveU(type, u);
+
+    if (u <= 0.0f) return EaseCurveU(type, 0.0f);
+    if (u >= 1.0f) return EaseCurveU(type, 1.0f);
+
+    int last = easeTableSize - 1;
+    float x = u*(float)last;
+
+    int i = (int)x;
+    if (i > last - 1) i = last - 1;
+    float f = x - (float)i;
+
+    if (interp == EASE_TABLE_LINEAR) return (p[i] + f*(p[i + 1] - p[i]));
+
+    float p0 = p[i - 1];
+    float p1 = p[i];
+    float p2 = p[i + 1];
+    float p3 = p[i + 2];
+
+    return (p1 + 0.5f*f*((p2 - p0) + f*((2.0f*p0 - 5.0f*p1 + 4.0f*p2 - p3) + f*(3.0f*(p1 - p2) + p3 - p0))));
+}
+
+EASEDEF float EaseTable(EaseType type, float t, float b, float c, float d, EaseTableInterp interp)
+{
+    return (c*EaseTableU(type, t/d, interp) + b);
+}
+
+// Stepper Easing functions
+
+EASEDEF float EaseStepperTime(const EaseStepper *stepper, int n) { return (stepper->t + (float)n*stepper->td); }
+
+EASEDEF float EaseStepperRestart(EaseStepper *stepper)
+{
+    int n = stepper->n;
+    float value = stepper->c*EaseCurveU(stepper->type, EaseStepperTime(stepper, n)/stepper->d) + stepper->b;
+    float h = stepper->td/stepper->d;
+
+    n++;
+    stepper->end = n;
+
+    // NOTE: Types without a recurrence (and steps td <= 0) stay exact after the first step
+    if ((stepper->kind == EASE_STEPPER_EXACT) && (n > 1)) return value;
+    if (!(h > 0.0f)) return value;
+
+    float u = EaseStepperTime(stepper, n)/stepper->d;
+    int first = (u < 0.5f);
+
+    // Curve of the segment as k0 + k1*x + k2*x^2 + k3*x^3 or k0 + a*2^(k*x)*sin(w*x + phase), x = u - o
+    float k0 = 0.0f, k1 = 0.0f, k2 = 0.0f, k3 = 0.0f;
+    float a = 0.0f, k = 0.0f, w = 0.0f, phase = PI/2.0f;
+    float o = 0.0f;
+    float s = 1.70158f;
+    float e = 2.0f*PI/0.3f;
+
+    switch (stepper->type)
+    {
+        case EASE_TYPE_LINEAR_NONE:
+        case EASE_TYPE_LINEAR_IN:
+        case EASE_TYPE_LINEAR_OUT:
+        case EASE_TYPE_LINEAR_IN_OUT: stepper->kind = EASE_STEPPER_POLY; k1 = 1.0f; break;
+        case EASE_TYPE_QUAD_IN: stepper->kind = EASE_STEPPER_POLY; k2 = 1.0f; break;
+        case EASE_TYPE_QUAD_OUT: stepper->kind = EASE_STEPPER_POLY; k1 = 2.0f; k2 = -1.0f; break;
+        case EASE_TYPE_QUAD_IN_OUT:
+        {
+            stepper->kind = EASE_STEPPER_POLY;
+            if (first) k2 = 2.0f;
+            else { o = 1.0f; k0 = 1.0f; k2 = -2.0f; }
+        } break;
+        case EASE_TYPE_CUBIC_IN: stepper->kind = EASE_STEPPER_POLY; k3 = 1.0f; break;
+        case EASE_TYPE_CUBIC_OUT: stepper->kind = EASE_STEPPER_POLY; o = 1.0f; k0 = 1.0f; k3 = 1.0f; break;
+        case EASE_TYPE_CUBIC_IN_OUT:
+        {
+            stepper->kind = EASE_STEPPER_POLY;
+            k3 = 4.0f;
+            if (!first) { o = 1.0f; k0 = 1.0f; }
+        } break;
+        case EASE_TYPE_BACK_IN: stepper->kind = EASE_STEPPER_POLY; k2 = -s; k3 = s + 1.0f; break;
+        case EASE_TYPE_BACK_OUT: stepper->kind = EASE_STEPPER_POLY; o = 1.0f; k0 = 1.0f; k2 = s; k3 = s + 1.0f; break;
+        case EASE_TYPE_BACK_IN_OUT:
+        {
+            stepper->kind = EASE_STEPPER_POLY;
+            s *= 1.525f;
+            k2 = -2.0f*s;
+            k3 = 4.0f*(s + 1.0f);
+            if (!first) { o = 1.0f; k0 = 1.0f; k2 = 2.0f*s; }
+        } break;
+        case EASE_TYPE_SINE_IN: stepper->kind = EASE_STEPPER_WAVE; k0 = 1.0f; a = -1.0f; w = PI/2.0f; break;
+        case EASE_TYPE_SINE_OUT: stepper->kind = EASE_STEPPER_WAVE; a = 1.0f; w = PI/2.0f; phase = 0.0f; break;
+        case EASE_TYPE_SINE_IN_OUT: stepper->kind = EASE_STEPPER_WAVE; k0 = 0.5f; a = -0.5f; w = PI; break;
+        case EASE_TYPE_EXPO_IN: stepper->kind = EASE_STEPPER_WAVE; o = 1.0f; a = 1.0f; k = 10.0f; break;
+        case EASE_TYPE_EXPO_OUT: stepper->kind = EASE_STEPPER_WAVE; k0 = 1.0f; a = -1.0f; k = -10.0f; break;
+        case EASE_TYPE_EXPO_IN_OUT:
+        {
+            stepper->kind = EASE_STEPPER_WAVE;
+            o = 0.5f;
+            if (first) { a = 0.5f; k = 20.0f; }
+            else { k0 = 1.0f; a = -0.5f; k = -20.0f; }
+        } break;
+        // NOTE: The Elastic phase (u - s)*(2*PI)/p is always w*u - PI/2, as s = p/4
+        case EASE_TYPE_ELASTIC_IN: stepper->kind = EASE_STEPPER_WAVE; o = 1.0f; a = -1.0f; k = 10.0f; w = e; phase = -PI/2.0f; break;
+        case EASE_TYPE_ELASTIC_OUT: stepper->kind = EASE_STEPPER_WAVE; k0 = 1.0f; a = 1.0f; k = -10.0f; w = e; phase = -PI/2.0f; break;
+        case EASE_TYPE_ELASTIC_IN_OUT:
+        {
+            stepper->kind = EASE_STEPPER_WAVE;
+            o = 0.5f;
+            w = 2.0f*(2.0f*PI/(0.3f*1.5f));
+            phase = -PI/2.0f;
+            if (first) { a = -0.5f; k = 20.0f; }
+            else { k0 = 1.0f; a = 0.5f; k = -20.0f; }
+        } break;
+        default: return value;      // Circ and Bounce
+    }
+
+    // Rebuild at the next resync or at the first step past the next breakpoint, whichever comes first
+    stepper->end = n + EASINGS_STEPPER_RESYNC;
+
+    if (u < 1.0f)
+    {
+        float next = (u < 0.0f)? 0.0f : (first? 0.5f : 1.0f);
+
+        if ((next - u)/h < (float)EASINGS_STEPPER_RESYNC)
+        {
+            int m = n + (int)((next - u)/h);
+
+            while ((m > n) && (EaseStepperTime(stepper, m - 1)/stepper->d >= next)) m--;
+            while (EaseStepperTime(stepper, m)/stepper->d < next) m++;
+
+            if (m < stepper->end) stepper->end = m;
+        }
+    }
+
+    float x = u - o;
+    float c = stepper->c;
+
+    if (stepper->kind == EASE_STEPPER_POLY)
+    {
+        float x2 = x*x;
+        float h2 = h*h;
+
+        stepper->v = c*(((k3*x + k2)*x + k1)*x + k0) + stepper->b;
+        stepper->d1 = c*(k1*h + k2*(2.0f*x*h + h2) + k3*(3.0f*x2*h + 3.0f*x*h2 + h2*h));
+        stepper->d2 = c*(2.0f*k2*h2 + k3*(6.0f*x*h2 + 6.0f*h2*h));
+        stepper->d3 = c*(6.0f*k3*h2*h);
+    }
+    else
+    {
+        stepper->base = c*k0 + stepper->b;
+        stepper->amp = c*a*EASINGS_EXP2F(k*x);
+        stepper->grow = EASINGS_EXP2F(k*h);
+        stepper->sn = EASINGS_SINF(w*x + phase);
+        stepper->cs = EASINGS_COSF(w*x + phase);
+        stepper->rotSin = EASINGS_SINF(w*h);
+        stepper->rotCos = EASINGS_COSF(w*h);
+    }
+
+    return value;
+}
+
+EASEDEF EaseStepper EaseStepperStart(EaseType type, float t, float td, float b, float c, float d)
+{
+    EaseStepper stepper;
+
+    memset(&stepper, 0, sizeof(stepper));
+    stepper.type = type;
+    stepper.t = t;
+    stepper.td = td;
+    stepper.b = b;
+    stepper.c = c;
+    stepper.d = d;
+
+    return stepper;
+}
+
+EASEDEF float EaseStepperNext(EaseStepper *stepper)
+{
+    float value;
+
+    if (stepper->n >= stepper->end) value = EaseStepperRestart(stepper);
+    else if (stepper->kind == EASE_STEPPER_POLY)
+    {
+        value = stepper->v;
+        stepper->v += stepper->d1;
+        stepper->d1 += stepper->d2;
+        stepper->d2 += stepper->d3;
+    }
+    else
+    {
+        value = stepper->amp*stepper->sn + stepper->base;
+
+        float sn = stepper->sn*stepper->rotCos + stepper->cs*stepper->rotSin;
+        stepper->cs = stepper->cs*stepper->rotCos - stepper->sn*stepper->rotSin;
+        stepper->sn = sn;
+        stepper->amp *= stepper->grow;
+    }
+
+    stepper->n++;
+
+    return value;
+}
+
+// Bezier Easing functions
+
+EASEDEF EaseBezier EaseBezierCreate(float x1, float y1, float x2, float y2)
+{
+    if (x1 < 0.0f) x1 = 0.0f;
+    if (x1 > 1.0f) x1 = 1.0f;
+    if (x2 < 0.0f) x2 = 0.0f;
+    if (x2 > 1.0f) x2 = 1.0f;
+
+    EaseBezier bezier = EASINGS_BEZIER_INIT(x1, y1, x2, y2);
+
+    return bezier;
+}
+
+EASEDEF float EaseBezierU(const EaseBezier *bezier, float u)
+{
+    if (u <= 0.0f) return 0.0f;
+    if (u >= 1.0f) return 1.0f;
+
+    const int last = EASINGS_BEZIER_SAMPLES - 1;
+    const float *samples = bezier->samples;
+
+    int i = 0;
+    while ((i < last - 1) && (samples[i + 1] <= u)) i++;
+
+    float x0 = samples[i];
+    float dx = samples[i + 1] - x0;
+    float s = ((float)i + ((dx > 0.0f)? (u - x0)/dx : 0.0f))/(float)last;
+    float slope = (3.0f*bezier->ax*s + 2.0f*bezier->bx)*s + bezier->cx;
+
+    if (slope >= EASINGS_BEZIER_NEWTON_MIN_SLOPE)
+    {
+        for (int k = 0; (k < EASINGS_BEZIER_NEWTON_ITERATIONS) && (slope != 0.0f); k++)
+        {
+            float x = ((bezier->ax*s + bezier->bx)*s + bezier->cx)*s - u;
+
+            if (fabsf(x) < EASINGS_BEZIER_PRECISION) break;
+
+            s -= x/slope;
+            slope = (3.0f*bezier->ax*s + 2.0f*bezier->bx)*s + bezier->cx;
+        }
+    }
+
+    // NOTE: Newton converges slowly where x(s) bends sharply (x1 = 0 or x2 = 1), bisection takes
+    // over inside the sample segment if it did not reach EASINGS_BEZIER_PRECISION
+    if (!(fabsf(((bezier->ax*s + bezier->bx)*s + bezier->cx)*s - u) < EASINGS_BEZIER_PRECISION))
+    {
+        float lo = (float)i/(float)last;
+        float hi = (float)(i + 1)/(float)last;
+
+        for (int k = 0; k < EASINGS_BEZIER_BISECTION_ITERATIONS; k++)
+        {
+            s = 0.5f*(lo + hi);
+
+            float x = ((bezier->ax*s + bezier->bx)*s + bezier->cx)*s - u;
+
+            if (fabsf(x) < EASINGS_BEZIER_PRECISION) break;
+
+            if (x > 0.0f) hi = s;
+            else lo = s;
+        }
+    }
+
+    return (((bezier->ay*s + bezier->by)*s + bezier->cy)*s);
+}
+
+EASEDEF float EaseBezierEval(const EaseBezier *bezier, float t, float b, float c, float d)
+{
+    return (c*EaseBezierU(bezier, t/d) + b);
+}
+
+// CSS keyword timing functions: ease, ease-in, ease-out and ease-in-out
+static const EaseBezier easeBezierCss[4] = {
+    EASINGS_BEZIER_INIT(0.25f, 0.1f, 0.25f, 1.0f),
+    EASINGS_BEZIER_INIT(0.42f, 0.0f, 1.0f, 1.0f),
+    EASINGS_BEZIER_INIT(0.0f, 0.0f, 0.58f, 1.0f),
+    EASINGS_BEZIER_INIT(0.42f, 0.0f, 0.58f, 1.0f)
+};
+
+EASEDEF float EaseCssEase(float t, float b, float c, float d) { return (c*EaseBezierU(&easeBezierCss[0], t/d) + b); }
+EASEDEF float EaseCssEaseIn(float t, float b, float c, float d) { return (c*EaseBezierU(&easeBezierCss[1], t/d) + b); }
+EASEDEF float EaseCssEaseOut(float t, float b, float c, float d) { return (c*EaseBezierU(&easeBezierCss[2], t/d) + b); }
+EASEDEF float EaseCssEaseInOut(float t, float b, float c, float d) { return (c*EaseBezierU(&easeBezierCss[3], t/d) + b); }
+
+// Parameterized Easing functions
+EASEDEF EaseBackParams EaseBackParamsCreate(float overshoot)
+{
+    EaseBackParams params;
+
+    params.s = overshoot;
+    params.s1 = overshoot + 1.0f;
+    params.sInOut = overshoot*1.525f;
+    params.sInOut1 = params.sInOut + 1.0f;
+
+    return params;
+}
+
+EASEDEF EaseElasticParams EaseElasticParamsCreate(float amplitude, float period)
+{
+    EaseElasticParams params;
+
+    if (!(period > 0.0f)) period = EASINGS_ELASTIC_PERIOD;
+
+    // Phase shift s in periods, a quarter with the minimum amplitude
+    params.a = (amplitude > 1.0f)? amplitude : 1.0f;
+    float shift = (params.a > 1.0f)? asinf(1.0f/params.a)/(2.0f*PI) : 0.25f;
+
+    params.w = (2.0f*PI)/period;
+    params.phase = -shift*(2.0f*PI);
+    params.wInOut = (2.0f*PI)/(period*1.5f);
+    params.phaseInOut = params.phase;
+
+    return params;
+}
+
+EASEDEF float EaseBackInExU(const EaseBackParams *params, float u)
+{
+    return (u*u*(params->s1*u - params->s));
+}
+
+EASEDEF float EaseBackOutExU(const EaseBackParams *params, float u)
+{
+    u -= 1.0f;
+    return (u*u*(params->s1*u + params->s) + 1.0f);
+}
+
+EASEDEF float EaseBackInOutExU(const EaseBackParams *params, float u)
+{
+    if ((u*=2.0f) < 1.0f) return (0.5f*(u*u*(params->sInOut1*u - params->sInOut)));
+
+    u -= 2.0f;
+    return (0.5f*(u*u*(params->sInOut1*u + params->sInOut) + 2.0f));
+}
+
+EASEDEF float EaseElasticInExU(const EaseElasticParams *params, float u)
+{
+    if (u == 0.0f) return 0.0f;
+    if (u == 1.0f) return 1.0f;
+
+    u -= 1.0f;
+
+    return (-(params->a*EASINGS_EXP2F(10.0f*u)*EASINGS_SINF(u*params->w + params->phase)));
+}
+
+EASEDEF float EaseElasticOutExU(const EaseElasticParams *params, float u)
+{
+    if (u == 0.0f) return 0.0f;
+    if (u == 1.0f) return 1.0f;
+
+    return (params->a*EASINGS_EXP2F(-10.0f*u)*EASINGS_SINF(u*params->w + params->phase) + 1.0f);
+}
+
+EASEDEF float EaseElasticInOutExU(const EaseElasticParams *params, float u)
+{
+    if (u == 0.0f) return 0.0f;
+    if ((u*=2.0f) == 2.0f) return 1.0f;
+
+    u -= 1.0f;
+    float angle = u*params->wInOut + params->phaseInOut;
+
+    if (u < 0.0f) return -0.5f*(params->a*EASINGS_EXP2F(10.0f*u)*EASINGS_SINF(angle));
+
+    return (params->a*EASINGS_EXP2F(-10.0f*u)*EASINGS_SINF(angle)*0.5f + 1.0f);
+}
+
+EASEDEF float EaseBackInEx(const EaseBackParams *params, float t, float b, float c, float d) { return (c*EaseBackInExU(params, t/d) + b); }
+EASEDEF float EaseBackOutEx(const EaseBackParams *params, float t, float b, float c, float d) { return (c*EaseBackOutExU(params, t/d) + b); }
+EASEDEF float EaseBackInOutEx(const EaseBackParams *params, float t, float b, float c, float d) { return (c*EaseBackInOutExU(params, t/d) + b); }
+
+EASEDEF float EaseElasticInEx(const EaseElasticParams *params, float t, float b, float c, float d) { return (c*EaseElasticInExU(params, t/d) + b); }
+EASEDEF float EaseElasticOutEx(const EaseElasticParams *params, float t, float b, float c, float d) { return (c*EaseElasticOutExU(params, t/d) + b); }
+EASEDEF float EaseElasticInOutEx(const EaseElasticParams *params, float t, float b, float c, float d) { return (c*EaseElasticInOutExU(params, t/d) + b); }
+
+// Batch Easing functions
+// NOTE: An EASINGS_IMPLEMENTATION file can define its own EASINGS_BATCH_DEFINE() before including
+// this file, easings_isa.c uses it to compile the batch functions once per instruction set
+#if !defined(EASINGS_BATCH_DEFINE)
+#define EASINGS_BATCH_DEFINE(func) \
+    EASEDEF void func##N(const float *EASINGS_RESTRICT t, float *EASINGS_RESTRICT out, size_t n, \
+                         float b, float c, float d) \
+    { \
+        for (size_t i = 0; i < n; i++) out[i] = func(t[i], b, c, d); \
+    } \
+    EASEDEF void func##NV(const float *EASINGS_RESTRICT t, float *EASINGS_RESTRICT out, size_t n, \
+                          const float *EASINGS_RESTRICT b, const float *EASINGS_RESTRICT c, \
+                          const float *EASINGS_RESTRICT d) \
+    { \
+        for (size_t i = 0; i < n; i++) out[i] = func(t[i], b[i], c[i], d[i]); \
+    }
+#endif
+
+EASINGS_BATCH_DEFINE(EaseLinearNone)
+EASINGS_BATCH_DEFINE(EaseLinearIn)
+EASINGS_BATCH_DEFINE(EaseLinearOut)
+EASINGS_BATCH_DEFINE(EaseLinearInOut)
+
+EASINGS_BATCH_DEFINE(EaseSineIn)
+EASINGS_BATCH_DEFINE(EaseSineOut)
+EASINGS_BATCH_DEFINE(EaseSineInOut)
+
+EASINGS_BATCH_DEFINE(EaseCircIn)
+EASINGS_BATCH_DEFINE(EaseCircOut)
+EASINGS_BATCH_DEFINE(EaseCircInOut)
+
+EASINGS_BATCH_DEFINE(EaseCubicIn)
+EASINGS_BATCH_DEFINE(EaseCubicOut)
+EASINGS_BATCH_DEFINE(EaseCubicInOut)
+
+EASINGS_BATCH_DEFINE(EaseQuadIn)
+EASINGS_BATCH_DEFINE(EaseQuadOut)
+EASINGS_BATCH_DEFINE(EaseQuadInOut)
+
+EASINGS_BATCH_DEFINE(EaseExpoIn)
+EASINGS_BATCH_DEFINE(EaseExpoOut)
+EASINGS_BATCH_DEFINE(EaseExpoInOut)
+
+EASINGS_BATCH_DEFINE(EaseBackIn)
+EASINGS_BATCH_DEFINE(EaseBackOut)
+EASINGS_BATCH_DEFINE(EaseBackInOut)
+
+EASINGS_BATCH_DEFINE(EaseBounceOut)
+EASINGS_BATCH_DEFINE(EaseBounceIn)
+EASINGS_BATCH_DEFINE(EaseBounceInOut)
+
+EASINGS_BATCH_DEFINE(EaseElasticIn)
+EASINGS_BATCH_DEFINE(EaseElasticOut)
+EASINGS_BATCH_DEFINE(EaseElasticInOut)
+
+EASINGS_BATCH_DEFINE(EaseCssEase)
+EASINGS_BATCH_DEFINE(EaseCssEaseIn)
+EASINGS_BATCH_DEFINE(EaseCssEaseOut)
+EASINGS_BATCH_DEFINE(EaseCssEaseInOut)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EASINGS_STATIC_INLINE || EASINGS_IMPLEMENTATION
 
 #endif // EASINGS_H
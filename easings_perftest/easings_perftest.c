@@ -26,7 +26,20 @@
 **********************************************************************************************/
 
 
+#define _POSIX_C_SOURCE 200112L  // Required for: clock_gettime()
+#define _DEFAULT_SOURCE  // Required for: syscall()
+
 #include "easings.h"
+#if defined(EASINGS_HAS_BATCH)
+	#include "easings_simd.h"  // NOTE: Needs the batch API, missing in older easings.h
+#endif
+#if defined(EASINGS_HAS_CURVES)
+	#define EASINGS_TWEEN_THREADS  // NOTE: Uses pthreads, see the Makefile
+	#include "easings_tween.h"  // NOTE: Needs the normalized curves
+#endif
+#if defined(EASINGS_ISA)
+	#include "easings_isa.h"  // NOTE: Needs EASINGS_EXTERN and libeasings_isa.so, see the Makefile
+#endif
 #include <stdio.h>
 #include <time.h>
 #include <string.h>
@@ -34,6 +47,36 @@
 #include <limits.h>
 #include <errno.h>
 #include <stdlib.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <math.h>  // Required for: sqrt(), fabs()
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+	#include <x86intrin.h>  // Required for: __rdtsc(), __rdtscp(), _mm_lfence()
+	#define PERFTEST_HAS_TSC
+#endif
+#if defined(__linux__)
+	#include <linux/perf_event.h>  // Required for: struct perf_event_attr, PERF_*
+	#include <sys/syscall.h>  // Required for: SYS_perf_event_open
+	#include <sys/ioctl.h>  // Required for: ioctl()
+	#include <unistd.h>  // Required for: syscall(), read(), close()
+	#define PERFTEST_HAS_COUNTERS
+#endif
+
+// NOTE: CLOCK_MONOTONIC_RAW isn't slewed by NTP, but it's Linux only
+#if defined(CLOCK_MONOTONIC_RAW)
+	#define TIMER_CLOCK CLOCK_MONOTONIC_RAW
+#else
+	#define TIMER_CLOCK CLOCK_MONOTONIC
+#endif
+
+// Makes the compiler compute value, and store what it points to, without using it
+// NOTE: Like benchmark::DoNotOptimize(), the empty asm takes value in a register or
+// in memory and may read any memory
+#if defined(__GNUC__)
+	#define DO_NOT_OPTIMIZE(value) __asm__ __volatile__("" : : "r,m"(value) : "memory")
+#else
+	#define DO_NOT_OPTIMIZE(value) ((void) (value))  // NOTE: Calls may be dropped
+#endif
 
 
 enum easing_types {
@@ -65,128 +108,394 @@ enum easing_types {
 	EASE_ELASTIC_IN,
 	EASE_ELASTIC_OUT,
 	EASE_ELASTIC_IN_OUT,
+#if defined(EASINGS_HAS_BEZIER)
+	EASE_CSS_EASE,
+	EASE_CSS_EASE_IN,
+	EASE_CSS_EASE_OUT,
+	EASE_CSS_EASE_IN_OUT,
+#endif
 	NUM_EASING_TYPES,
 };
 
+#define NUM_PENNER_TYPES (EASE_ELASTIC_IN_OUT + 1)  // NOTE: Same order as EaseType
+
+#if defined(EASINGS_HAS_BATCH)
+	#define BATCH_FUNC(func) .batch = func##N,
+#else
+	#define BATCH_FUNC(func)
+#endif
+
+#if defined(EASINGS_HAS_DERIVATIVES)
+	#define FUSED_FUNC(func) .fused = func##Fused,
+#else
+	#define FUSED_FUNC(func)
+#endif
+
 static const struct {
 	const char *name;
 	float (*func)(float, float, float, float);
+#if defined(EASINGS_HAS_BATCH)
+	void (*batch)(const float *, float *, size_t, float, float, float);
+#endif
+#if defined(EASINGS_HAS_DERIVATIVES)
+	float (*fused)(float, float, float, float, float *);
+#endif
 } easings[] = {
 	[EASE_LINEAR_NONE] = {
 		.name = "EaseLinearNone",
 		.func = EaseLinearNone,
+		BATCH_FUNC(EaseLinearNone)
+		FUSED_FUNC(EaseLinearNone)
 	},
 	[EASE_LINEAR_IN] = {
 		.name = "EaseLinearIn",
 		.func = EaseLinearIn,
+		BATCH_FUNC(EaseLinearIn)
+		FUSED_FUNC(EaseLinearIn)
 	},
 	[EASE_LINEAR_OUT] = {
 		.name = "EaseLinearOut",
 		.func = EaseLinearOut,
+		BATCH_FUNC(EaseLinearOut)
+		FUSED_FUNC(EaseLinearOut)
 	},
 	[EASE_LINEAR_IN_OUT] = {
 		.name = "EaseLinearInOut",
 		.func = EaseLinearInOut,
+		BATCH_FUNC(EaseLinearInOut)
+		FUSED_FUNC(EaseLinearInOut)
 	},
 	[EASE_SINE_IN] = {
 		.name = "EaseSineIn",
 		.func = EaseSineIn,
+		BATCH_FUNC(EaseSineIn)
+		FUSED_FUNC(EaseSineIn)
 	},
 	[EASE_SINE_OUT] = {
 		.name = "EaseSineOut",
 		.func = EaseSineOut,
+		BATCH_FUNC(EaseSineOut)
+		FUSED_FUNC(EaseSineOut)
 	},
 	[EASE_SINE_IN_OUT] = {
 		.name = "EaseSineInOut",
 		.func = EaseSineInOut,
+		BATCH_FUNC(EaseSineInOut)
+		FUSED_FUNC(EaseSineInOut)
 	},
 	[EASE_CIRC_IN] = {
 		.name = "EaseCircIn",
 		.func = EaseCircIn,
+		BATCH_FUNC(EaseCircIn)
+		FUSED_FUNC(EaseCircIn)
 	},
 	[EASE_CIRC_OUT] = {
 		.name = "EaseCircOut",
 		.func = EaseCircOut,
+		BATCH_FUNC(EaseCircOut)
+		FUSED_FUNC(EaseCircOut)
 	},
 	[EASE_CIRC_IN_OUT] = {
 		.name = "EaseCircInOut",
 		.func = EaseCircInOut,
+		BATCH_FUNC(EaseCircInOut)
+		FUSED_FUNC(EaseCircInOut)
 	},
 	[EASE_CUBIC_IN] = {
 		.name = "EaseCubicIn",
 		.func = EaseCubicIn,
+		BATCH_FUNC(EaseCubicIn)
+		FUSED_FUNC(EaseCubicIn)
 	},
 	[EASE_CUBIC_OUT] = {
 		.name = "EaseCubicOut",
 		.func = EaseCubicOut,
+		BATCH_FUNC(EaseCubicOut)
+		FUSED_FUNC(EaseCubicOut)
 	},
 	[EASE_CUBIC_IN_OUT] = {
 		.name = "EaseCubicInOut",
 		.func = EaseCubicInOut,
+		BATCH_FUNC(EaseCubicInOut)
+		FUSED_FUNC(EaseCubicInOut)
 	},
 	[EASE_QUAD_IN] = {
 		.name = "EaseQuadIn",
 		.func = EaseQuadIn,
+		BATCH_FUNC(EaseQuadIn)
+		FUSED_FUNC(EaseQuadIn)
 	},
 	[EASE_QUAD_OUT] = {
 		.name = "EaseQuadOut",
 		.func = EaseQuadOut,
+		BATCH_FUNC(EaseQuadOut)
+		FUSED_FUNC(EaseQuadOut)
 	},
 	[EASE_QUAD_IN_OUT] = {
 		.name = "EaseQuadInOut",
 		.func = EaseQuadInOut,
+		BATCH_FUNC(EaseQuadInOut)
+		FUSED_FUNC(EaseQuadInOut)
 	},
 	[EASE_EXPO_IN] = {
 		.name = "EaseExpoIn",
 		.func = EaseExpoIn,
+		BATCH_FUNC(EaseExpoIn)
+		FUSED_FUNC(EaseExpoIn)
 	},
 	[EASE_EXPO_OUT] = {
 		.name = "EaseExpoOut",
 		.func = EaseExpoOut,
+		BATCH_FUNC(EaseExpoOut)
+		FUSED_FUNC(EaseExpoOut)
 	},
 	[EASE_EXPO_IN_OUT] = {
 		.name = "EaseExpoInOut",
 		.func = EaseExpoInOut,
+		BATCH_FUNC(EaseExpoInOut)
+		FUSED_FUNC(EaseExpoInOut)
 	},
 	[EASE_BACK_IN] = {
 		.name = "EaseBackIn",
 		.func = EaseBackIn,
+		BATCH_FUNC(EaseBackIn)
+		FUSED_FUNC(EaseBackIn)
 	},
 	[EASE_BACK_OUT] = {
 		.name = "EaseBackOut",
 		.func = EaseBackOut,
+		BATCH_FUNC(EaseBackOut)
+		FUSED_FUNC(EaseBackOut)
 	},
 	[EASE_BACK_IN_OUT] = {
 		.name = "EaseBackInOut",
 		.func = EaseBackInOut,
+		BATCH_FUNC(EaseBackInOut)
+		FUSED_FUNC(EaseBackInOut)
 	},
 	[EASE_BOUNCE_OUT] = {
 		.name = "EaseBounceOut",
 		.func = EaseBounceOut,
+		BATCH_FUNC(EaseBounceOut)
+		FUSED_FUNC(EaseBounceOut)
 	},
 	[EASE_BOUNCE_IN] = {
 		.name = "EaseBounceIn",
 		.func = EaseBounceIn,
+		BATCH_FUNC(EaseBounceIn)
+		FUSED_FUNC(EaseBounceIn)
 	},
 	[EASE_BOUNCE_IN_OUT] = {
 		.name = "EaseBounceInOut",
 		.func = EaseBounceInOut,
+		BATCH_FUNC(EaseBounceInOut)
+		FUSED_FUNC(EaseBounceInOut)
 	},
 	[EASE_ELASTIC_IN] = {
 		.name = "EaseElasticIn",
 		.func = EaseElasticIn,
+		BATCH_FUNC(EaseElasticIn)
+		FUSED_FUNC(EaseElasticIn)
 	},
 	[EASE_ELASTIC_OUT] = {
 		.name = "EaseElasticOut",
 		.func = EaseElasticOut,
+		BATCH_FUNC(EaseElasticOut)
+		FUSED_FUNC(EaseElasticOut)
 	},
 	[EASE_ELASTIC_IN_OUT] = {
 		.name = "EaseElasticInOut",
 		.func = EaseElasticInOut,
+		BATCH_FUNC(EaseElasticInOut)
+		FUSED_FUNC(EaseElasticInOut)
+	},
+#if defined(EASINGS_HAS_BEZIER)
+	[EASE_CSS_EASE] = {
+		.name = "EaseCssEase",
+		.func = EaseCssEase,
+		BATCH_FUNC(EaseCssEase)
+	},
+	[EASE_CSS_EASE_IN] = {
+		.name = "EaseCssEaseIn",
+		.func = EaseCssEaseIn,
+		BATCH_FUNC(EaseCssEaseIn)
 	},
+	[EASE_CSS_EASE_OUT] = {
+		.name = "EaseCssEaseOut",
+		.func = EaseCssEaseOut,
+		BATCH_FUNC(EaseCssEaseOut)
+	},
+	[EASE_CSS_EASE_IN_OUT] = {
+		.name = "EaseCssEaseInOut",
+		.func = EaseCssEaseInOut,
+		BATCH_FUNC(EaseCssEaseInOut)
+	},
+#endif
+};
+
+
+// Hardware counters read around each timed loop with --counters
+enum counters {
+	COUNTER_CYCLES,
+	COUNTER_INSTRUCTIONS,
+	COUNTER_BRANCH_MISSES,
+	COUNTER_L1D_MISSES,
+	NUM_COUNTERS,
+};
+
+static const char *counter_names[] = {
+	[COUNTER_CYCLES] = "cycles",
+	[COUNTER_INSTRUCTIONS] = "instructions",
+	[COUNTER_BRANCH_MISSES] = "branch misses",
+	[COUNTER_L1D_MISSES] = "L1d misses",
+};
+
+// Time taken by a timed loop
+struct timing {
+	double ns;
+	double cycles;  // NOTE: TSC ticks, 0 without --tsc
+	double counts[NUM_COUNTERS];  // NOTE: 0 for the counters not open
+};
+
+// Start of a timed loop
+struct timer {
+	struct timespec start;
+	uint64_t start_tsc;
+};
+
+static struct timer timer_start(void);
+static struct timing timer_stop(const struct timer *timer);
+#if defined(PERFTEST_HAS_COUNTERS)
+static int open_counters(void);
+static void close_counters(void);
+#endif
+#define MAX_SAMPLES 1000L
+
+// Samples of a timing per call, taken until sampler_add() returns 0
+struct sampler {
+	struct timing samples[MAX_SAMPLES];
+	int n;
+	int warmup;  // NOTE: Runs left to discard before taking samples
+	const struct timing *empty;  // NOTE: Empty loop of the timed loop, per iteration
+};
+
+// Statistics of the samples of a sampler, see get_sample_stats()
+struct sample_stats {
+	double median;
+	double mad;  // NOTE: Median absolute deviation
+	double ci_low;  // NOTE: 95% confidence interval of the median
+	double ci_high;
+	double cycles;  // NOTE: Median cycles
+	double counts[NUM_COUNTERS];  // NOTE: Median counts
+	int n;
+	int outliers;
+};
+
+static int end_timings(FILE *fp, int status);
+static struct timing time_empty_loop(int batch, long it, float td);
+#if defined(EASINGS_HAS_DISPATCH) || defined(EASINGS_HAS_TWEENS)
+static struct timing time_empty_frames(long n, int frames);
+static void timing_add(struct timing *sum, struct timing timing);
+#endif
+static void sampler_start(struct sampler *sampler, const struct timing *empty);
+static int sampler_add(struct sampler *sampler, struct timing timing,
+                       long calls);
+static struct sample_stats get_sample_stats(const struct sampler *sampler);
+static void print_samples(FILE *fp, const struct sampler *sampler,
+                          const char *unit, const char *label_format, ...);
+static struct timing time_pointer(enum easing_types type, long it, float b,
+                                  float c, float d, float td);
+static double checksum_func(enum easing_types type, long it, float b, float c,
+                            float d, float td);
+static struct timing time_direct(enum easing_types type, long it, float b,
+                                 float c, float d, float td);
+#if defined(EASINGS_HAS_PARAMS)
+static struct timing time_params(enum easing_types type, long it, float b,
+                                 float c, float d, float td);
+#endif
+#if defined(EASINGS_HAS_BATCH)
+static struct timing time_batch(void (*batch)(const float *, float *, size_t,
+                                               float, float, float),
+                                long it, float b, float c, float d, float td);
+#endif
+#if defined(EASINGS_HAS_PREPARED)
+static struct timing time_prepared(EaseType type, long it, float b, float c,
+                                   float d, float td);
+#endif
+#if defined(EASINGS_HAS_STEPPER)
+static struct timing time_stepper(EaseType type, long it, float b, float c,
+                                  float d, float td);
+#endif
+#if defined(EASINGS_HAS_TABLE)
+static struct timing time_table(EaseType type, EaseTableInterp interp, long it,
+                                float b, float c, float d, float td);
+#endif
+#if defined(EASINGS_HAS_VECTOR)
+enum vector_modes {
+	VECTOR_SCALAR,
+	VECTOR_SINGLE,
+	VECTOR_SCALAR_BATCH,
+	VECTOR_AOS,
+	VECTOR_SOA,
+	NUM_VECTOR_MODES,
+};
+
+static const char *vector_mode_names[] = {
+	[VECTOR_SCALAR] = "scalar per channel",
+	[VECTOR_SINGLE] = "vector",
+	[VECTOR_SCALAR_BATCH] = "batch per channel",
+	[VECTOR_AOS] = "vector batch aos",
+	[VECTOR_SOA] = "vector batch soa",
+};
+
+static struct timing time_vector(enum easing_types type,
+                                 enum vector_modes mode, long it, float b,
+                                 float c, float d, float td);
+#endif
+#if defined(EASINGS_HAS_TWEENS)
+// Tween updated by calling its function pointer, as callers do without the tween engine
+struct aos_tween {
+	float (*func)(float, float, float, float);
+	float start;
+	float b;
+	float c;
+	float d;
+	float *target;
+};
+
+static double checksum_tweens(const struct aos_tween *aos, long n);
+static int time_tweens(FILE *fp, long n, long threads, float b, float c,
+                       float d, float td);
+#endif
+#if defined(EASINGS_HAS_DERIVATIVES)
+static struct timing time_deriv(enum easing_types type, int fused, long it,
+                                float b, float c, float d, float td);
+#endif
+#if defined(EASINGS_HAS_TRACKS)
+static int time_tracks(FILE *fp, float b, float c, float td);
+#endif
+#if defined(EASINGS_HAS_DISPATCH)
+enum dispatch_modes {
+	DISPATCH_POINTER,
+	DISPATCH_SWITCH,
+	DISPATCH_BUCKETS,
+	NUM_DISPATCH_MODES,
 };
 
+static const char *dispatch_mode_names[] = {
+	[DISPATCH_POINTER] = "function pointers",
+	[DISPATCH_SWITCH] = "switch",
+	[DISPATCH_BUCKETS] = "type buckets",
+};
 
+static void set_dispatch_times(float *t, long n, int f, float d, float td);
+static void ease_dispatch_frame(enum dispatch_modes mode, const EaseType *types,
+                                const float *t, float *out, long n,
+                                const float *b, const float *c, const float *d,
+                                uint32_t *order);
+static int time_dispatch(FILE *fp, long n, float b, float c, float d,
+                         float td);
+#endif
 static int get_float_arg(char *argvi, char *arg_prefix, float min, float max,
                          float *arg_var);
 static int get_long_arg(char *argvi, char *arg_prefix, long min, long max,
@@ -204,7 +513,41 @@ static int get_string_arg(char *argvi, char *arg_prefix, char *arg_array,
 	"      --d=<val>: Makes <val> the total time the interpolation takes\n"\
 	"      --td=<val>: Makes <val> the time unit advanced in each iteration\n"\
 	"      --it=<ival>: Makes <ival> the number of iterations used\n"\
+	"      --tsc: Also reads the time stamp counter around each timed loop\n"\
+	"        and reports cycles / call (x86 only)\n"\
+	"      --counters: Also counts cycles, instructions, branch misses and\n"\
+	"        L1d misses around each timed loop with perf_event_open, and\n"\
+	"        reports the IPC and the misses / call (Linux only)\n"\
+	"      --samples=<ival>: Times each loop <ival> times, rejects the\n"\
+	"        outliers and reports the median, the MAD and a 95%% confidence\n"\
+	"        interval of the median\n"\
+	"      --warmup=<ival>: Runs each loop <ival> times before sampling it\n"\
+	"      --rel-err=<val>: Stops sampling a loop once half the confidence\n"\
+	"        interval is below <val> times the median (at most --samples,\n"\
+	"        or 100 samples)\n"\
 	"      --out=<file>: Writes the results to a stream specified by <file>\n"\
+	"      --lut: Also times the table easings at each table size\n"\
+	"      --random: Uses random times in [0, d] instead of advancing by td,\n"\
+	"        so branches on t can't be predicted\n"\
+	"      --vec: Also times easing 4 channel values, with a scalar call per\n"\
+	"        channel and with the vector functions\n"\
+	"      --deriv: Also times getting the value and the velocity, with two\n"\
+	"        calls (finite difference) and with one fused call\n"\
+	"      --direct: Also times calling each function by name instead of\n"\
+	"        through a pointer, so inline and LTO builds can inline it (see\n"\
+	"        compare_builds.sh)\n"\
+	"      --params: Also times the Back and Elastic functions taking their\n"\
+	"        parameters, called by name (compare with --direct)\n"\
+	"      --tweens=<ival>: Times the tween engine updating <ival> tweens of\n"\
+	"        mixed types per frame, then replacing some of them every frame,\n"\
+	"        instead of the functions\n"\
+	"      --threads=<ival>: With --tweens, also times the parallel update\n"\
+	"        with 1 to <ival> threads\n"\
+	"      --dispatch=<ival>: Times easing <ival> items of random types per\n"\
+	"        frame through function pointers, a switch and type buckets,\n"\
+	"        instead of the functions\n"\
+	"      --tracks: Times keyframe tracks of 10 to 10000 keys sampled every td\n"\
+	"        and at random times, instead of the functions\n"\
 	"    <val> must be a floating-point value inside a range defined by the\n"\
 	"    program for each option. <ival> must be an integer value inside a\n"\
 	"    range defined by the program. <file> must be a valid path to a file\n"\
@@ -229,6 +572,12 @@ static int get_string_arg(char *argvi, char *arg_prefix, char *arg_array,
 #define MIN_D 0.2f
 #define MAX_D ((FLT_MAX) / (MAX_LIMIT_DIV))
 #define MAX_IT ((LONG_MAX) / (MAX_LIMIT_DIV_L))
+#define MAX_TWEENS (1L << 26)
+#define MAX_THREADS 64L
+#define MAX_DISPATCH (1L << 26)
+#define MAX_WARMUP 100L
+#define MIN_REL_ERR 0.0001f
+#define MAX_REL_ERR 1.0f
 
 #define DFT_ARG_B 0.0f
 #define DFT_ARG_C 2000.0f
@@ -236,6 +585,47 @@ static int get_string_arg(char *argvi, char *arg_prefix, char *arg_array,
 #define DFT_ARG_TD 0.5f
 #define DFT_ARG_IT 1000000L
 
+#define BATCH_SIZE 1024
+#define RANDOM_T_SIZE 4096  // NOTE: Must be a power of two
+#define RANDOM_T_SEED 1234u
+#define TWEEN_FRAMES 60
+#define VECTOR_CHANNELS 4
+#define DERIV_STEP_DIV 16.0f
+#define TRACK_MAX_KEYS 10000
+#define TRACK_LOOKUPS 1000000L
+#define TWEEN_CHURN_DIV 10  // NOTE: 1/10 of the tweens are replaced per churn frame
+#define TWEEN_LINE_FLOATS (EASINGS_TWEEN_LINE_SIZE / (long) sizeof(float))
+#define EMPTY_LOOP_RUNS 5
+#define MIN_AUTO_SAMPLES 5  // NOTE: Fewest samples (not outliers) before --rel-err can stop sampling
+#define DFT_AUTO_SAMPLES 100L  // NOTE: Most samples with --rel-err and no --samples
+#define OUTLIER_Z 3.5  // NOTE: Modified z-score above which a sample is an outlier
+#define CI_95_Z 1.96
+#define NEAR_EMPTY_FRAC 0.05  // NOTE: Timings below 5% of the empty loop are suspicious
+
+// Takes samples of a timing, the value of timing_expr, into sampler, to subtract
+// the empty loop *empty when printing them
+#define SAMPLE_TIMING(sampler, empty, calls, timing_expr) \
+	do { \
+		sampler_start(&(sampler), (empty)); \
+		while (sampler_add(&(sampler), (timing_expr), (calls))) {} \
+	} while (0)
+
+// Time of the next iteration: t + td, or a value from random_t with --random
+#define NEXT_T(t, td, j) \
+	((random_t != NULL)? random_t[(j) & (RANDOM_T_SIZE - 1)] : (t) + (td))
+
+static float random_t_values[RANDOM_T_SIZE];
+static const float *random_t = NULL;
+static int use_tsc = 0;  // NOTE: Set by --tsc
+static long samples_max = 1L;  // NOTE: Set by --samples
+static long warmup_runs = 0L;  // NOTE: Set by --warmup
+static float target_rel_err = 0.0f;  // NOTE: Set by --rel-err, 0 takes every sample
+static int near_empty_timings = 0;  // NOTE: Counted by print_samples()
+static int counter_fds[NUM_COUNTERS] = {-1, -1, -1, -1};  // NOTE: Opened by --counters
+static int counter_group = -1;  // NOTE: First open counter, leads the others
+static struct timing empty_loop = { .ns = 0.0 };  // NOTE: Per iteration, see time_empty_loop()
+static struct timing empty_batch_loop = { .ns = 0.0 };
+
 
 int main(int argc, char *argv[])
 {
@@ -253,8 +643,26 @@ int main(int argc, char *argv[])
 		unsigned char td: 1;
 		unsigned char it: 1;
 		unsigned char out: 1;
+		unsigned char lut: 1;
+		unsigned char random: 1;
+		unsigned char tweens: 1;
+		unsigned char threads: 1;
+		unsigned char vec: 1;
+		unsigned char dispatch: 1;
+		unsigned char tracks: 1;
+		unsigned char deriv: 1;
+		unsigned char direct: 1;
+		unsigned char params: 1;
+		unsigned char tsc: 1;
+		unsigned char samples: 1;
+		unsigned char warmup: 1;
+		unsigned char rel_err: 1;
+		unsigned char counters: 1;
 	} args_set = {
-		.b = 0, .c = 0, .d = 0, .td = 0, .it = 0, .out = 0,
+		.b = 0, .c = 0, .d = 0, .td = 0, .it = 0, .out = 0, .lut = 0,
+		.random = 0, .tweens = 0, .threads = 0, .vec = 0, .dispatch = 0,
+		.tracks = 0, .deriv = 0, .direct = 0, .params = 0, .tsc = 0,
+		.samples = 0, .warmup = 0, .rel_err = 0, .counters = 0,
 	};
 
 	float arg_b = 0.0f;
@@ -262,6 +670,12 @@ int main(int argc, char *argv[])
 	float arg_d = 0.0f;
 	float arg_td = 0.0f;
 	long arg_it = 0L;
+	long arg_tweens = 0L;
+	long arg_threads = 0L;
+	long arg_dispatch = 0L;
+	long arg_samples = 0L;
+	long arg_warmup = 0L;
+	float arg_rel_err = 0.0f;
 	char arg_out[FILENAME_MAX] = {'\0'};
 
 	for (int i = 1; argv[i] != NULL; ++i) {
@@ -307,8 +721,110 @@ int main(int argc, char *argv[])
 			}
 		}
 		else
+		if (strcmp(argv[i], "--lut") == 0) {
+			args_set.lut = 1;
+		}
+		else
+		if (strcmp(argv[i], "--random") == 0) {
+			args_set.random = 1;
+		}
+		else
+		if (strcmp(argv[i], "--vec") == 0) {
+			args_set.vec = 1;
+		}
+		else
+		if (strcmp(argv[i], "--tracks") == 0) {
+			args_set.tracks = 1;
+		}
+		else
+		if (strcmp(argv[i], "--deriv") == 0) {
+			args_set.deriv = 1;
+		}
+		else
+		if (strcmp(argv[i], "--direct") == 0) {
+			args_set.direct = 1;
+		}
+		else
+		if (strcmp(argv[i], "--params") == 0) {
+			args_set.params = 1;
+		}
+		else
+		if (strcmp(argv[i], "--tsc") == 0) {
+			args_set.tsc = 1;
+		}
+		else
+		if (strcmp(argv[i], "--counters") == 0) {
+			args_set.counters = 1;
+		}
+		else
+		if (args_set.samples == 0 &&
+		    strncmp(argv[i], "--samples=", strlen("--samples=")) == 0)
+		{
+			if (get_long_arg(argv[i], "--samples=", 1L, MAX_SAMPLES,
+			                 &arg_samples) == 0)
+			{
+				args_set.samples = 1;
+			}
+		}
+		else
+		if (args_set.warmup == 0 &&
+		    strncmp(argv[i], "--warmup=", strlen("--warmup=")) == 0)
+		{
+			if (get_long_arg(argv[i], "--warmup=", 0L, MAX_WARMUP,
+			                 &arg_warmup) == 0)
+			{
+				args_set.warmup = 1;
+			}
+		}
+		else
+		if (args_set.rel_err == 0 &&
+		    strncmp(argv[i], "--rel-err=", strlen("--rel-err=")) == 0)
+		{
+			if (get_float_arg(argv[i], "--rel-err=", MIN_REL_ERR, MAX_REL_ERR,
+			                  &arg_rel_err) == 0)
+			{
+				args_set.rel_err = 1;
+			}
+		}
+		else
+		if (args_set.tweens == 0 &&
+		    strncmp(argv[i], "--tweens=", strlen("--tweens=")) == 0)
+		{
+			if (get_long_arg(argv[i], "--tweens=", 1L, MAX_TWEENS,
+			                 &arg_tweens) == 0)
+			{
+				args_set.tweens = 1;
+			}
+		}
+		else
+		if (args_set.threads == 0 &&
+		    strncmp(argv[i], "--threads=", strlen("--threads=")) == 0)
+		{
+			if (get_long_arg(argv[i], "--threads=", 1L, MAX_THREADS,
+			                 &arg_threads) == 0)
+			{
+				args_set.threads = 1;
+			}
+		}
+		else
+		if (args_set.dispatch == 0 &&
+		    strncmp(argv[i], "--dispatch=", strlen("--dispatch=")) == 0)
+		{
+			if (get_long_arg(argv[i], "--dispatch=", 1L, MAX_DISPATCH,
+			                 &arg_dispatch) == 0)
+			{
+				args_set.dispatch = 1;
+			}
+		}
+		else
 		if (args_set.b == 1 && args_set.c == 1 && args_set.d == 1 &&
-		    args_set.td == 1 && args_set.it == 1 && args_set.out == 1)
+		    args_set.td == 1 && args_set.it == 1 && args_set.out == 1 &&
+		    args_set.lut == 1 && args_set.random == 1 && args_set.tweens == 1 &&
+		    args_set.threads == 1 && args_set.vec == 1 && args_set.dispatch == 1 &&
+		    args_set.tracks == 1 && args_set.deriv == 1 && args_set.direct == 1 &&
+		    args_set.params == 1 && args_set.tsc == 1 && args_set.samples == 1 &&
+		    args_set.warmup == 1 && args_set.rel_err == 1 &&
+		    args_set.counters == 1)
 		{
 			break;
 		}
@@ -351,35 +867,1570 @@ int main(int argc, char *argv[])
 		fprintf(stderr, "Using file %s\n", arg_out);
 	}
 
+	if (args_set.random == 1) {
+		srand(RANDOM_T_SEED);
+
+		for (int i = 0; i < RANDOM_T_SIZE; ++i) {
+			random_t_values[i] = arg_d * ((float) rand() / (float) RAND_MAX);
+		}
+
+		random_t = random_t_values;
+		fprintf(stderr, "Using %d random times in [0, d]\n", RANDOM_T_SIZE);
+	}
+
+	if (args_set.tsc == 1) {
+#if defined(PERFTEST_HAS_TSC)
+		use_tsc = 1;
+		fprintf(stderr, "Using the time stamp counter\n");
+#else
+		fprintf(stderr, "No time stamp counter on this target, ignoring --tsc\n");
+#endif
+	}
+
+	if (args_set.samples == 1) {
+		samples_max = arg_samples;
+	}
+	else
+	if (args_set.rel_err == 1) {
+		samples_max = DFT_AUTO_SAMPLES;
+	}
+
+	if (args_set.warmup == 1) {
+		warmup_runs = arg_warmup;
+	}
+
+	if (args_set.rel_err == 1) {
+		target_rel_err = arg_rel_err;
+	}
+
+	if (samples_max > 1L || warmup_runs > 0L) {
+		fprintf(stderr, "Using %ld warmup runs and up to %ld samples per timing",
+		        warmup_runs, samples_max);
+
+		if (target_rel_err > 0.0f) {
+			fprintf(stderr, ", until the relative error is below %f",
+			        target_rel_err);
+		}
+
+		fprintf(stderr, "\n");
+	}
+
+	if (args_set.counters == 1) {
+#if defined(PERFTEST_HAS_COUNTERS)
+		if (open_counters() == 0) {
+			fprintf(stderr, "No performance counters (perf_event_paranoid or a container may block them), ignoring --counters\n");
+		}
+#else
+		fprintf(stderr, "No perf_event_open on this target, ignoring --counters\n");
+#endif
+	}
+
 	fprintf(stderr, "Using args b = %f, c = %f, d = %f, td = %f\n",
 	        arg_b, arg_c, arg_d, arg_td);
 	fprintf(fp, "arg_b = %f,\narg_c = %f,\narg_d = %f,\narg_td = %f,\n",
 	            arg_b, arg_c, arg_d, arg_td);
-	fprintf(fp, "Doing %ld iterations per function\n\n", arg_it);
+
+	if (args_set.tweens == 1) {
+#if defined(EASINGS_HAS_TWEENS)
+		int status = time_tweens(fp, arg_tweens, arg_threads, arg_b, arg_c,
+		                         arg_d, arg_td);
+
+		return end_timings(fp, status);
+#else
+		fprintf(stderr, "easings.h has no normalized curves, ignoring --tweens\n");
+#endif
+	}
+
+	if (args_set.tracks == 1) {
+#if defined(EASINGS_HAS_TRACKS)
+		int status = time_tracks(fp, arg_b, arg_c, arg_td);
+
+		return end_timings(fp, status);
+#else
+		fprintf(stderr, "easings.h has no normalized curves, ignoring --tracks\n");
+#endif
+	}
+
+	if (args_set.dispatch == 1) {
+#if defined(EASINGS_HAS_DISPATCH)
+		int status = time_dispatch(fp, arg_dispatch, arg_b, arg_c, arg_d,
+		                           arg_td);
+
+		return end_timings(fp, status);
+#else
+		fprintf(stderr, "easings.h has no dispatch functions, ignoring --dispatch\n");
+#endif
+	}
+
+	empty_loop = time_empty_loop(0, arg_it, arg_td);
+	empty_batch_loop = time_empty_loop(1, arg_it, arg_td);
+
+	fprintf(fp, "Doing %ld iterations per function%s\n", arg_it,
+	            (random_t != NULL)? " (random times)" : "");
+	fprintf(fp, "Empty loop: %f ns / iter, %f ns / iter in batches",
+	            empty_loop.ns, empty_batch_loop.ns);
+
+	if (use_tsc) {
+		fprintf(fp, ", %f and %f cycles / iter (TSC at %f GHz)",
+		            empty_loop.cycles, empty_batch_loop.cycles,
+		            empty_loop.cycles / empty_loop.ns);
+	}
+
+	fprintf(fp, ", subtracted from each timing\n");
+
+	if (samples_max > 1L) {
+		fprintf(fp, "Up to %ld samples per timing after %ld warmup runs, median, MAD and 95%% CI of the median\n",
+		            samples_max, warmup_runs);
+	}
+
+	fprintf(fp, "\n");
+
+	struct sampler sampler;
 
 	for (enum easing_types i = 0; i < NUM_EASING_TYPES; ++i) {
-		float t = 0.0f;
-		float result;  // NOTE: Compiler will warn about unused variable
+		SAMPLE_TIMING(sampler, &empty_loop, arg_it,
+		              time_pointer(i, arg_it, arg_b, arg_c, arg_d, arg_td));
 
-		clock_t clock_val = clock();
+		fprintf(fp, "%s: checksum %.9g\n", easings[i].name,
+		            checksum_func(i, arg_it, arg_b, arg_c, arg_d, arg_td));
+		print_samples(fp, &sampler, "call", "");
 
-		for (long j = 0; j < arg_it; ++j) {
-			result = easings[i].func(t, arg_b, arg_c, arg_d);
-			t += arg_td;
+		if (args_set.direct == 1) {
+			SAMPLE_TIMING(sampler, &empty_loop, arg_it,
+			              time_direct(i, arg_it, arg_b, arg_c, arg_d, arg_td));
+
+			print_samples(fp, &sampler, "call", "direct");
+		}
+
+#if defined(EASINGS_HAS_PARAMS)
+		if (args_set.params == 1 &&
+		    ((i >= EASE_BACK_IN && i <= EASE_BACK_IN_OUT) ||
+		     (i >= EASE_ELASTIC_IN && i <= EASE_ELASTIC_IN_OUT)))
+		{
+			SAMPLE_TIMING(sampler, &empty_loop, arg_it,
+			              time_params(i, arg_it, arg_b, arg_c, arg_d, arg_td));
+
+			print_samples(fp, &sampler, "call", "params");
+		}
+#endif
+
+#if defined(EASINGS_HAS_BATCH)
+		SAMPLE_TIMING(sampler, &empty_batch_loop, arg_it,
+		              time_batch(easings[i].batch, arg_it, arg_b, arg_c, arg_d,
+		                         arg_td));
+
+		print_samples(fp, &sampler, "call", "batch");
+#endif
+
+		// NOTE: The bezier easings have no EaseType for the timings below
+		if (i >= NUM_PENNER_TYPES) {
+			fprintf(fp, "\n");
+			continue;
+		}
+
+#if defined(EASINGS_HAS_PREPARED)
+		SAMPLE_TIMING(sampler, &empty_loop, arg_it,
+		              time_prepared((EaseType) i, arg_it, arg_b, arg_c, arg_d,
+		                            arg_td));
+
+		print_samples(fp, &sampler, "call", "prepared");
+#endif
+
+#if defined(EASINGS_HAS_STEPPER)
+		// NOTE: Steppers only advance by td, there is no stepper timing with --random
+		if (random_t == NULL) {
+			SAMPLE_TIMING(sampler, &empty_loop, arg_it,
+			              time_stepper((EaseType) i, arg_it, arg_b, arg_c, arg_d,
+			                           arg_td));
+
+			print_samples(fp, &sampler, "call", "stepper");
+		}
+#endif
+
+#if defined(EASINGS_HAS_SIMD)
+		for (EaseSimdLevel level = EASE_SIMD_SSE41; level <= EaseSimdDetect();
+		     ++level)
+		{
+			SAMPLE_TIMING(sampler, &empty_batch_loop, arg_it,
+			              time_batch(EaseSimdGetFunc((EaseType) i, level), arg_it,
+			                         arg_b, arg_c, arg_d, arg_td));
+
+			print_samples(fp, &sampler, "call", "simd %s",
+			              EaseSimdLevelName(level));
+		}
+#endif
+
+#if defined(EASINGS_HAS_ISA)
+		// NOTE: The batch timing above uses the version picked when loading the library
+		for (EaseIsaLevel level = EASE_ISA_BASELINE; level <= EaseIsaDetect();
+		     ++level)
+		{
+			SAMPLE_TIMING(sampler, &empty_batch_loop, arg_it,
+			              time_batch(EaseIsaGetBatch((EaseType) i, level), arg_it,
+			                         arg_b, arg_c, arg_d, arg_td));
+
+			print_samples(fp, &sampler, "call", "batch %s",
+			              EaseIsaLevelName(level));
+		}
+#endif
+
+#if defined(EASINGS_HAS_DERIVATIVES)
+		for (int fused = 0; args_set.deriv == 1 && fused <= 1; ++fused) {
+			SAMPLE_TIMING(sampler, &empty_loop, arg_it,
+			              time_deriv(i, fused, arg_it, arg_b, arg_c, arg_d,
+			                         arg_td));
+
+			print_samples(fp, &sampler, "call", "value + velocity, %s",
+			              fused? "fused" : "two calls");
+		}
+#endif
+
+#if defined(EASINGS_HAS_VECTOR)
+		for (enum vector_modes mode = 0;
+		     args_set.vec == 1 && mode < NUM_VECTOR_MODES; ++mode)
+		{
+			SAMPLE_TIMING(sampler, (mode >= VECTOR_SCALAR_BATCH)?
+			              &empty_batch_loop : &empty_loop, arg_it,
+			              time_vector(i, mode, arg_it, arg_b, arg_c, arg_d,
+			                          arg_td));
+
+			print_samples(fp, &sampler, "call", "%d channels, %s",
+			              VECTOR_CHANNELS, vector_mode_names[mode]);
+		}
+#endif
+
+#if defined(EASINGS_HAS_TABLE)
+		for (int size = EASINGS_TABLE_MIN_SIZE;
+		     args_set.lut == 1 && size <= EASINGS_TABLE_MAX_SIZE; size *= 4)
+		{
+			EaseTableSetSize(size);
+
+			SAMPLE_TIMING(sampler, &empty_loop, arg_it,
+			              time_table((EaseType) i, EASE_TABLE_LINEAR, arg_it,
+			                         arg_b, arg_c, arg_d, arg_td));
+
+			print_samples(fp, &sampler, "call", "table %d linear", size);
+
+			SAMPLE_TIMING(sampler, &empty_loop, arg_it,
+			              time_table((EaseType) i, EASE_TABLE_CATMULL_ROM, arg_it,
+			                         arg_b, arg_c, arg_d, arg_td));
+
+			print_samples(fp, &sampler, "call", "table %d catmull-rom", size);
 		}
+#endif
 
-		clock_val = clock() - clock_val;
+		fprintf(fp, "\n");
+	}
+
+	return end_timings(fp, EXIT_SUCCESS);
+}
 
-		fprintf(fp, "%s:\n %10ld clocks, %10f clks / iter\n\n",
-		            easings[i].name, clock_val, clock_val / (double) arg_it);
+// Warns about the timings near the empty loop, closes the counters and fp,
+// unless it's stdout, and returns status
+static int end_timings(FILE *fp, int status)
+{
+	if (near_empty_timings > 0) {
+		fprintf(stderr, "Warning: %d timings are near or below the empty loop, their calls may have been dropped or run in the shadow of the loop\n",
+		        near_empty_timings);
 	}
 
-	if (arg_out[0] != '\0') {
+#if defined(PERFTEST_HAS_COUNTERS)
+	close_counters();
+#endif
+
+	if (fp != stdout) {
 		fclose(fp);
 	}
 
-	return EXIT_SUCCESS;
+	return status;
+}
+
+// Starts timing a loop, starting the counters, reading the clock and then, with
+// --tsc, the TSC
+static struct timer timer_start(void)
+{
+	struct timer timer = { .start_tsc = 0 };
+
+#if defined(PERFTEST_HAS_COUNTERS)
+	if (counter_group != -1) {
+		ioctl(counter_group, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+		ioctl(counter_group, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	}
+#endif
+
+	clock_gettime(TIMER_CLOCK, &timer.start);
+
+#if defined(PERFTEST_HAS_TSC)
+	if (use_tsc) {
+		// NOTE: The lfences keep rdtsc from running before the code above or after
+		// the start of the loop
+		_mm_lfence();
+		timer.start_tsc = __rdtsc();
+		_mm_lfence();
+	}
+#endif
+
+	return timer;
+}
+
+// Stops timing a loop, reading the TSC first so the clock read isn't counted, and
+// the counters last
+static struct timing timer_stop(const struct timer *timer)
+{
+	struct timing timing = { .cycles = 0.0 };
+	struct timespec stop;
+
+#if defined(PERFTEST_HAS_TSC)
+	if (use_tsc) {
+		unsigned int aux;
+
+		// NOTE: rdtscp waits for the loop to finish, the lfence keeps the code
+		// after it from starting early
+		uint64_t stop_tsc = __rdtscp(&aux);
+		_mm_lfence();
+
+		timing.cycles = (double) (stop_tsc - timer->start_tsc);
+	}
+#endif
+
+	clock_gettime(TIMER_CLOCK, &stop);
+
+	timing.ns = (stop.tv_sec - timer->start.tv_sec) * 1e9 +
+	            (stop.tv_nsec - timer->start.tv_nsec);
+
+#if defined(PERFTEST_HAS_COUNTERS)
+	if (counter_group != -1) {
+		ioctl(counter_group, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+		for (int k = 0; k < NUM_COUNTERS; ++k) {
+			uint64_t values[3];  // NOTE: Count, time enabled, time running
+
+			if (counter_fds[k] != -1 &&
+			    read(counter_fds[k], values, sizeof(values)) == sizeof(values) &&
+			    values[2] > 0)
+			{
+				// NOTE: Scales the count up if the kernel multiplexed the counter
+				timing.counts[k] = (double) values[0] * values[1] / values[2];
+			}
+		}
+	}
+#endif
+
+	return timing;
+}
+
+#if defined(PERFTEST_HAS_COUNTERS)
+// Opens the counters that perf_event_open allows, as a group led by the first
+// one, counting this thread in user mode. Returns how many are open
+// NOTE: Containers and perf_event_paranoid > 2 usually refuse all of them
+static int open_counters(void)
+{
+	static const struct {
+		uint32_t type;
+		uint64_t config;
+	} events[NUM_COUNTERS] = {
+		[COUNTER_CYCLES] = {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+		[COUNTER_INSTRUCTIONS] = {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+		[COUNTER_BRANCH_MISSES] = {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+		[COUNTER_L1D_MISSES] = {PERF_TYPE_HW_CACHE,
+		                        PERF_COUNT_HW_CACHE_L1D |
+		                        (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+		                        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+	};
+	int opened = 0;
+
+	for (int k = 0; k < NUM_COUNTERS; ++k) {
+		struct perf_event_attr attr;
+
+		memset(&attr, 0, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = events[k].type;
+		attr.config = events[k].config;
+		attr.disabled = (counter_group == -1);  // NOTE: The leader enables the group
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED |
+		                   PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+		int fd = (int) syscall(SYS_perf_event_open, &attr, 0, -1, counter_group,
+		                       0UL);
+
+		if (fd == -1) {
+			fprintf(stderr, "Can't open the %s counter: %s\n", counter_names[k],
+			        strerror(errno));
+			continue;
+		}
+
+		if (counter_group == -1) {
+			counter_group = fd;
+		}
+
+		counter_fds[k] = fd;
+		++opened;
+	}
+
+	if (opened > 0) {
+		fprintf(stderr, "Using %d performance counters\n", opened);
+	}
+
+	return opened;
+}
+
+// Closes the open counters, the leader last
+static void close_counters(void)
+{
+	for (int k = NUM_COUNTERS - 1; k >= 0; --k) {
+		if (counter_fds[k] != -1) {
+			close(counter_fds[k]);
+			counter_fds[k] = -1;
+		}
+	}
+
+	counter_group = -1;
+}
+#endif
+
+// Times the loop around the calls, advancing t and sinking it, without the calls,
+// or with batch, the loop around the batch calls filling the batches of times
+// NOTE: Returns the fastest of EMPTY_LOOP_RUNS runs, per iteration
+static struct timing time_empty_loop(int batch, long it, float td)
+{
+	struct timing best = { .ns = 0.0 };
+	float t_batch[BATCH_SIZE];
+
+	for (int run = 0; run < EMPTY_LOOP_RUNS; ++run) {
+		float t = 0.0f;
+
+		struct timer timer = timer_start();
+
+		if (batch) {
+			for (long j = 0; j < it; j += BATCH_SIZE) {
+				size_t n = (it - j < BATCH_SIZE)? (size_t) (it - j) : BATCH_SIZE;
+
+				for (size_t k = 0; k < n; ++k) {
+					t_batch[k] = t;
+					t = NEXT_T(t, td, j + k);
+				}
+
+				DO_NOT_OPTIMIZE(t_batch);
+			}
+		}
+		else {
+			for (long j = 0; j < it; ++j) {
+				DO_NOT_OPTIMIZE(t);
+				t = NEXT_T(t, td, j);
+			}
+		}
+
+		struct timing timing = timer_stop(&timer);
+
+		if (run == 0 || timing.ns < best.ns) {
+			best = timing;
+		}
+	}
+
+	best.ns /= it;
+	best.cycles /= it;
+
+	return best;
+}
+
+#if defined(EASINGS_HAS_DISPATCH) || defined(EASINGS_HAS_TWEENS)
+// Times the frames of the dispatch and tween timings without their work: frames
+// frames of a loop over n items sinking each index, timing each frame
+// NOTE: Returns the fastest of EMPTY_LOOP_RUNS runs, per item
+static struct timing time_empty_frames(long n, int frames)
+{
+	struct timing best = { .ns = 0.0 };
+
+	for (int run = 0; run < EMPTY_LOOP_RUNS; ++run) {
+		struct timing timing = { .ns = 0.0 };
+
+		for (int f = 0; f < frames; ++f) {
+			struct timer timer = timer_start();
+
+			for (long k = 0; k < n; ++k) {
+				DO_NOT_OPTIMIZE(k);
+			}
+
+			timing_add(&timing, timer_stop(&timer));
+		}
+
+		if (run == 0 || timing.ns < best.ns) {
+			best = timing;
+		}
+	}
+
+	best.ns /= (double) frames * n;
+	best.cycles /= (double) frames * n;
+
+	return best;
+}
+
+// Adds timing to sum, for loops timed in parts
+static void timing_add(struct timing *sum, struct timing timing)
+{
+	sum->ns += timing.ns;
+	sum->cycles += timing.cycles;
+
+	for (int k = 0; k < NUM_COUNTERS; ++k) {
+		sum->counts[k] += timing.counts[k];
+	}
+}
+#endif
+
+// Clears the samples and resets the warmup runs of a sampler, whose timed loop
+// has the empty loop empty
+static void sampler_start(struct sampler *sampler, const struct timing *empty)
+{
+	sampler->n = 0;
+	sampler->warmup = (int) warmup_runs;
+	sampler->empty = empty;
+}
+
+// Adds the timing of a loop of calls calls as a sample, unless it's a warmup run.
+// Returns whether to time the loop again: until there are samples_max samples
+// or, with --rel-err, until half the confidence interval is below
+// target_rel_err times the median
+static int sampler_add(struct sampler *sampler, struct timing timing,
+                       long calls)
+{
+	if (sampler->warmup > 0) {
+		--sampler->warmup;
+		return 1;
+	}
+
+	sampler->samples[sampler->n].ns = timing.ns / calls;
+	sampler->samples[sampler->n].cycles = timing.cycles / calls;
+
+	for (int k = 0; k < NUM_COUNTERS; ++k) {
+		sampler->samples[sampler->n].counts[k] = timing.counts[k] / calls;
+	}
+
+	++sampler->n;
+
+	if (sampler->n >= samples_max) {
+		return 0;
+	}
+
+	if (target_rel_err > 0.0f && sampler->n >= MIN_AUTO_SAMPLES) {
+		struct sample_stats stats = get_sample_stats(sampler);
+
+		return stats.n < MIN_AUTO_SAMPLES ||
+		       (stats.ci_high - stats.ci_low) / 2.0 >
+		       target_rel_err * stats.median;
+	}
+
+	return 1;
+}
+
+static int compare_doubles(const void *a, const void *b)
+{
+	double x = *(const double *) a;
+	double y = *(const double *) b;
+
+	return (x > y) - (x < y);
+}
+
+// Median of n sorted values
+static double sorted_median(const double *values, int n)
+{
+	return (n % 2 == 1)? values[n / 2] :
+	                     (values[n / 2 - 1] + values[n / 2]) / 2.0;
+}
+
+// Median and MAD of n values, sorting them
+static void median_mad(double *values, int n, double *median, double *mad)
+{
+	double deviations[MAX_SAMPLES];
+
+	qsort(values, n, sizeof(double), compare_doubles);
+	*median = sorted_median(values, n);
+
+	for (int k = 0; k < n; ++k) {
+		deviations[k] = fabs(values[k] - *median);
+	}
+
+	qsort(deviations, n, sizeof(double), compare_doubles);
+	*mad = sorted_median(deviations, n);
+}
+
+// Gets the median, the MAD and a 95% confidence interval of the median of the
+// samples in ns per call, without the slow samples with a modified z-score
+// (0.6745 * deviation / MAD) above OUTLIER_Z
+// NOTE: Only slow samples are outliers, interrupts and other programs can't make
+// a loop faster
+// NOTE: The interval is between the order statistics n/2 -+ 1.96 sqrt(n)/2, so it
+// doesn't assume a distribution
+static struct sample_stats get_sample_stats(const struct sampler *sampler)
+{
+	struct sample_stats stats = { .n = 0 };
+	double ns[MAX_SAMPLES];
+	double kept_ns[MAX_SAMPLES];
+	double values[MAX_SAMPLES];
+	int kept[MAX_SAMPLES];
+	double median;
+	double mad;
+
+	for (int k = 0; k < sampler->n; ++k) {
+		ns[k] = sampler->samples[k].ns;
+	}
+
+	median_mad(ns, sampler->n, &median, &mad);
+
+	for (int k = 0; k < sampler->n; ++k) {
+		const struct timing *sample = &sampler->samples[k];
+
+		if (mad > 0.0 && 0.6745 * (sample->ns - median) / mad > OUTLIER_Z) {
+			++stats.outliers;
+			continue;
+		}
+
+		kept_ns[stats.n] = sample->ns;
+		kept[stats.n] = k;
+		++stats.n;
+	}
+
+	median_mad(kept_ns, stats.n, &stats.median, &stats.mad);
+
+	for (int k = 0; k < stats.n; ++k) {
+		values[k] = sampler->samples[kept[k]].cycles;
+	}
+
+	qsort(values, stats.n, sizeof(double), compare_doubles);
+	stats.cycles = sorted_median(values, stats.n);
+
+	for (int counter = 0; counter < NUM_COUNTERS; ++counter) {
+		for (int k = 0; k < stats.n; ++k) {
+			values[k] = sampler->samples[kept[k]].counts[counter];
+		}
+
+		qsort(values, stats.n, sizeof(double), compare_doubles);
+		stats.counts[counter] = sorted_median(values, stats.n);
+	}
+
+	double half_width = CI_95_Z * sqrt(stats.n) / 2.0;
+	int low = (int) floor(stats.n / 2.0 - half_width);
+	int high = (int) ceil(stats.n / 2.0 + half_width);
+
+	stats.ci_low = kept_ns[(low < 0)? 0 : low];
+	stats.ci_high = kept_ns[(high > stats.n - 1)? stats.n - 1 : high];
+
+	return stats;
+}
+
+// Prints the time per unit (call, item, ...) of the samples minus the empty loop, with
+// their statistics if there's more than one, labeled by label_format unless it's empty
+// NOTE: Marks and counts the timings below NEAR_EMPTY_FRAC of the empty loop, their
+// loop may do no more than the empty loop
+static void print_samples(FILE *fp, const struct sampler *sampler,
+                          const char *unit, const char *label_format, ...)
+{
+	struct sample_stats stats = get_sample_stats(sampler);
+	const struct timing *empty = sampler->empty;
+
+	fprintf(fp, " %10f ns / %s", stats.median - empty->ns, unit);
+
+	if (use_tsc) {
+		fprintf(fp, ", %10f cycles / %s", stats.cycles - empty->cycles, unit);
+	}
+
+	// NOTE: The counts include the loop, they aren't minus the empty loop
+	if (counter_fds[COUNTER_CYCLES] != -1 &&
+	    counter_fds[COUNTER_INSTRUCTIONS] != -1 &&
+	    stats.counts[COUNTER_CYCLES] > 0.0)
+	{
+		fprintf(fp, ", IPC %f", stats.counts[COUNTER_INSTRUCTIONS] /
+		                        stats.counts[COUNTER_CYCLES]);
+	}
+
+	for (int k = COUNTER_BRANCH_MISSES; k <= COUNTER_L1D_MISSES; ++k) {
+		if (counter_fds[k] != -1) {
+			fprintf(fp, ", %f %s / %s", stats.counts[k], counter_names[k], unit);
+		}
+	}
+
+	if (sampler->n > 1) {
+		fprintf(fp, ", MAD %f, 95%% CI [%f, %f], %d samples, %d outliers",
+		            stats.mad, stats.ci_low - empty->ns,
+		            stats.ci_high - empty->ns, stats.n, stats.outliers);
+	}
+
+	if (stats.median - empty->ns < NEAR_EMPTY_FRAC * empty->ns) {
+		fprintf(fp, ", near the empty loop");
+		++near_empty_timings;
+	}
+
+	if (label_format[0] != '\0') {
+		va_list args;
+
+		va_start(args, label_format);
+		fprintf(fp, " (");
+		vfprintf(fp, label_format, args);
+		fprintf(fp, ")");
+		va_end(args);
+	}
+
+	fprintf(fp, "\n");
+}
+
+// Times it calls of an easing function through easings[type].func
+static struct timing time_pointer(enum easing_types type, long it, float b,
+                                  float c, float d, float td)
+{
+	float t = 0.0f;
+
+	struct timer timer = timer_start();
+
+	for (long j = 0; j < it; ++j) {
+		DO_NOT_OPTIMIZE(easings[type].func(t, b, c, d));
+		t = NEXT_T(t, td, j);
+	}
+
+	return timer_stop(&timer);
+}
+
+// Sums it values of easings[type].func over the times of the timed loops, so the
+// results of different builds and headers can be compared
+// NOTE: Not timed, the timed loops only sink the values
+static double checksum_func(enum easing_types type, long it, float b, float c,
+                            float d, float td)
+{
+	float t = 0.0f;
+	double checksum = 0.0;
+
+	for (long j = 0; j < it; ++j) {
+		checksum += easings[type].func(t, b, c, d);
+		t = NEXT_T(t, td, j);
+	}
+
+	return checksum;
+}
+
+// Loop of time_direct() calling func by name
+#define DIRECT_CASE(type, func) \
+	case type: \
+		for (long j = 0; j < it; ++j) { \
+			DO_NOT_OPTIMIZE(func(t, b, c, d)); \
+			t = NEXT_T(t, td, j); \
+		} \
+		break;
+
+// Times it calls of an easing function by name, where the main loop calls it through
+// easings[type].func
+static struct timing time_direct(enum easing_types type, long it, float b,
+                                 float c, float d, float td)
+{
+	float t = 0.0f;
+
+	struct timer timer = timer_start();
+
+	switch (type) {
+		DIRECT_CASE(EASE_LINEAR_NONE, EaseLinearNone)
+		DIRECT_CASE(EASE_LINEAR_IN, EaseLinearIn)
+		DIRECT_CASE(EASE_LINEAR_OUT, EaseLinearOut)
+		DIRECT_CASE(EASE_LINEAR_IN_OUT, EaseLinearInOut)
+		DIRECT_CASE(EASE_SINE_IN, EaseSineIn)
+		DIRECT_CASE(EASE_SINE_OUT, EaseSineOut)
+		DIRECT_CASE(EASE_SINE_IN_OUT, EaseSineInOut)
+		DIRECT_CASE(EASE_CIRC_IN, EaseCircIn)
+		DIRECT_CASE(EASE_CIRC_OUT, EaseCircOut)
+		DIRECT_CASE(EASE_CIRC_IN_OUT, EaseCircInOut)
+		DIRECT_CASE(EASE_CUBIC_IN, EaseCubicIn)
+		DIRECT_CASE(EASE_CUBIC_OUT, EaseCubicOut)
+		DIRECT_CASE(EASE_CUBIC_IN_OUT, EaseCubicInOut)
+		DIRECT_CASE(EASE_QUAD_IN, EaseQuadIn)
+		DIRECT_CASE(EASE_QUAD_OUT, EaseQuadOut)
+		DIRECT_CASE(EASE_QUAD_IN_OUT, EaseQuadInOut)
+		DIRECT_CASE(EASE_EXPO_IN, EaseExpoIn)
+		DIRECT_CASE(EASE_EXPO_OUT, EaseExpoOut)
+		DIRECT_CASE(EASE_EXPO_IN_OUT, EaseExpoInOut)
+		DIRECT_CASE(EASE_BACK_IN, EaseBackIn)
+		DIRECT_CASE(EASE_BACK_OUT, EaseBackOut)
+		DIRECT_CASE(EASE_BACK_IN_OUT, EaseBackInOut)
+		DIRECT_CASE(EASE_BOUNCE_OUT, EaseBounceOut)
+		DIRECT_CASE(EASE_BOUNCE_IN, EaseBounceIn)
+		DIRECT_CASE(EASE_BOUNCE_IN_OUT, EaseBounceInOut)
+		DIRECT_CASE(EASE_ELASTIC_IN, EaseElasticIn)
+		DIRECT_CASE(EASE_ELASTIC_OUT, EaseElasticOut)
+		DIRECT_CASE(EASE_ELASTIC_IN_OUT, EaseElasticInOut)
+#if defined(EASINGS_HAS_BEZIER)
+		DIRECT_CASE(EASE_CSS_EASE, EaseCssEase)
+		DIRECT_CASE(EASE_CSS_EASE_IN, EaseCssEaseIn)
+		DIRECT_CASE(EASE_CSS_EASE_OUT, EaseCssEaseOut)
+		DIRECT_CASE(EASE_CSS_EASE_IN_OUT, EaseCssEaseInOut)
+#endif
+		default: break;
+	}
+
+	return timer_stop(&timer);
+}
+
+#if defined(EASINGS_HAS_PARAMS)
+// Loop of time_params() calling func by name with its parameters
+#define PARAMS_CASE(type, func, params) \
+	case type: \
+		for (long j = 0; j < it; ++j) { \
+			DO_NOT_OPTIMIZE(func(params, t, b, c, d)); \
+			t = NEXT_T(t, td, j); \
+		} \
+		break;
+
+// Times it calls of the parameterized version of a Back or Elastic easing, with
+// the parameters of the fixed one
+static struct timing time_params(enum easing_types type, long it, float b,
+                                 float c, float d, float td)
+{
+	EaseBackParams back = EaseBackParamsCreate(EASINGS_BACK_OVERSHOOT);
+	EaseElasticParams elastic = EaseElasticParamsCreate(1.0f, EASINGS_ELASTIC_PERIOD);
+	float t = 0.0f;
+
+	struct timer timer = timer_start();
+
+	switch (type) {
+		PARAMS_CASE(EASE_BACK_IN, EaseBackInEx, &back)
+		PARAMS_CASE(EASE_BACK_OUT, EaseBackOutEx, &back)
+		PARAMS_CASE(EASE_BACK_IN_OUT, EaseBackInOutEx, &back)
+		PARAMS_CASE(EASE_ELASTIC_IN, EaseElasticInEx, &elastic)
+		PARAMS_CASE(EASE_ELASTIC_OUT, EaseElasticOutEx, &elastic)
+		PARAMS_CASE(EASE_ELASTIC_IN_OUT, EaseElasticInOutEx, &elastic)
+		default: break;
+	}
+
+	return timer_stop(&timer);
+}
+#endif
+
+#if defined(EASINGS_HAS_BATCH)
+static struct timing time_batch(void (*batch)(const float *, float *, size_t,
+                                               float, float, float),
+                                long it, float b, float c, float d, float td)
+{
+	float t_batch[BATCH_SIZE];
+	float out_batch[BATCH_SIZE];
+	float t = 0.0f;
+
+	struct timer timer = timer_start();
+
+	for (long j = 0; j < it; j += BATCH_SIZE) {
+		size_t n = (it - j < BATCH_SIZE)? (size_t) (it - j) : BATCH_SIZE;
+
+		for (size_t k = 0; k < n; ++k) {
+			t_batch[k] = t;
+			t = NEXT_T(t, td, j + k);
+		}
+
+		batch(t_batch, out_batch, n, b, c, d);
+		DO_NOT_OPTIMIZE(out_batch);
+	}
+
+	return timer_stop(&timer);
+}
+#endif
+
+#if defined(EASINGS_HAS_PREPARED)
+// Times it evaluations of the prepared easing of type
+static struct timing time_prepared(EaseType type, long it, float b, float c,
+                                   float d, float td)
+{
+	EasePrepared prepared = EasePrepare(type, b, c, d);
+	float t = 0.0f;
+
+	struct timer timer = timer_start();
+
+	for (long j = 0; j < it; ++j) {
+		DO_NOT_OPTIMIZE(EasePreparedEval(&prepared, t));
+		t = NEXT_T(t, td, j);
+	}
+
+	return timer_stop(&timer);
+}
+#endif
+
+#if defined(EASINGS_HAS_STEPPER)
+// Times it steps of a stepper of type advancing by td
+static struct timing time_stepper(EaseType type, long it, float b, float c,
+                                  float d, float td)
+{
+	EaseStepper stepper = EaseStepperStart(type, 0.0f, td, b, c, d);
+
+	struct timer timer = timer_start();
+
+	for (long j = 0; j < it; ++j) {
+		DO_NOT_OPTIMIZE(EaseStepperNext(&stepper));
+	}
+
+	return timer_stop(&timer);
+}
+#endif
+
+#if defined(EASINGS_HAS_TABLE)
+static struct timing time_table(EaseType type, EaseTableInterp interp, long it,
+                                float b, float c, float d, float td)
+{
+	float t = 0.0f;
+
+	EaseTableGet(type);  // NOTE: Builds the table outside of the timed loop
+
+	struct timer timer = timer_start();
+
+	for (long j = 0; j < it; ++j) {
+		DO_NOT_OPTIMIZE(EaseTable(type, t, b, c, d, interp));
+		t = NEXT_T(t, td, j);
+	}
+
+	return timer_stop(&timer);
+}
+#endif
+
+#if defined(EASINGS_HAS_DERIVATIVES)
+// Gets it values and velocities, from two calls td / DERIV_STEP_DIV apart or
+// from the fused function
+static struct timing time_deriv(enum easing_types type, int fused, long it,
+                                float b, float c, float d, float td)
+{
+	float h = td / DERIV_STEP_DIV;
+	float t = 0.0f;
+
+	struct timer timer = timer_start();
+
+	if (fused) {
+		for (long j = 0; j < it; ++j) {
+			float velocity;
+
+			DO_NOT_OPTIMIZE(easings[type].fused(t, b, c, d, &velocity));
+			DO_NOT_OPTIMIZE(velocity);
+			t = NEXT_T(t, td, j);
+		}
+	}
+	else {
+		for (long j = 0; j < it; ++j) {
+			float value = easings[type].func(t, b, c, d);
+
+			DO_NOT_OPTIMIZE(value);
+			DO_NOT_OPTIMIZE((easings[type].func(t + h, b, c, d) - value) / h);
+			t = NEXT_T(t, td, j);
+		}
+	}
+
+	return timer_stop(&timer);
+}
+#endif
+
+#if defined(EASINGS_HAS_VECTOR)
+// Eases it values of VECTOR_CHANNELS channels, each channel with its own b and c
+static struct timing time_vector(enum easing_types type,
+                                 enum vector_modes mode, long it, float b,
+                                 float c, float d, float td)
+{
+	static float b_batch[VECTOR_CHANNELS * BATCH_SIZE];
+	static float c_batch[VECTOR_CHANNELS * BATCH_SIZE];
+	static float out_batch[VECTOR_CHANNELS * BATCH_SIZE];
+	float t_batch[BATCH_SIZE];
+	float channel_b[VECTOR_CHANNELS];
+	float channel_c[VECTOR_CHANNELS];
+	float *out_soa[VECTOR_CHANNELS];
+	const float *b_soa[VECTOR_CHANNELS];
+	const float *c_soa[VECTOR_CHANNELS];
+	float t = 0.0f;
+
+	// NOTE: AoS uses the arrays as b[j*VECTOR_CHANNELS + k], SoA as b[k*BATCH_SIZE + j]
+	for (int k = 0; k < VECTOR_CHANNELS; ++k) {
+		channel_b[k] = b + k;
+		channel_c[k] = c / (k + 1);
+		out_soa[k] = out_batch + k * BATCH_SIZE;
+		b_soa[k] = b_batch + k * BATCH_SIZE;
+		c_soa[k] = c_batch + k * BATCH_SIZE;
+	}
+
+	for (int j = 0; j < VECTOR_CHANNELS * BATCH_SIZE; ++j) {
+		b_batch[j] = channel_b[j % VECTOR_CHANNELS];
+		c_batch[j] = channel_c[j % VECTOR_CHANNELS];
+	}
+
+	struct timer timer = timer_start();
+
+	if (mode == VECTOR_SCALAR) {
+		for (long j = 0; j < it; ++j) {
+			for (int k = 0; k < VECTOR_CHANNELS; ++k) {
+				DO_NOT_OPTIMIZE(easings[type].func(t, channel_b[k], channel_c[k],
+				                                   d));
+			}
+
+			t = NEXT_T(t, td, j);
+		}
+	}
+	else
+	if (mode == VECTOR_SINGLE) {
+		float out[VECTOR_CHANNELS];
+
+		for (long j = 0; j < it; ++j) {
+			EaseVector((EaseType) type, t, channel_b, channel_c, d, out,
+			           VECTOR_CHANNELS);
+
+			DO_NOT_OPTIMIZE(out);
+			t = NEXT_T(t, td, j);
+		}
+	}
+	else {
+		for (long j = 0; j < it; j += BATCH_SIZE) {
+			size_t n = (it - j < BATCH_SIZE)? (size_t) (it - j) : BATCH_SIZE;
+
+			for (size_t k = 0; k < n; ++k) {
+				t_batch[k] = t;
+				t = NEXT_T(t, td, j + k);
+			}
+
+			if (mode == VECTOR_SCALAR_BATCH) {
+				for (int k = 0; k < VECTOR_CHANNELS; ++k) {
+					easings[type].batch(t_batch, out_soa[k], n, channel_b[k],
+					                    channel_c[k], d);
+				}
+			}
+			else
+			if (mode == VECTOR_AOS) {
+				EaseVectorN((EaseType) type, t_batch, out_batch, n,
+				            VECTOR_CHANNELS, b_batch, c_batch, d);
+			}
+			else {
+				EaseVectorSoAN((EaseType) type, t_batch, out_soa, n,
+				               VECTOR_CHANNELS, b_soa, c_soa, d);
+			}
+
+			DO_NOT_OPTIMIZE(out_batch);
+		}
+	}
+
+	return timer_stop(&timer);
+}
+#endif
+
+#if defined(EASINGS_HAS_TRACKS)
+// Builds tracks of 10 to TRACK_MAX_KEYS keys and looks each one up TRACK_LOOKUPS
+// times advancing by td (looping back to the start at the end) and at random times,
+// with the track cursor and with a binary search each time
+// NOTE: Keys are TRACK_LOOKUPS * td / keys apart, so advancing by td covers the whole track
+static int time_tracks(FILE *fp, float b, float c, float td)
+{
+	static float seek_times[RANDOM_T_SIZE];
+	EaseTrack track;
+	int status = EXIT_SUCCESS;
+
+	EaseTrackInit(&track);
+	srand(RANDOM_T_SEED);
+
+	// NOTE: The lookups advance t like the function timings, so they share their empty loop
+	struct timing empty = time_empty_loop(0, TRACK_LOOKUPS, td);
+	struct sampler sampler;
+
+	fprintf(fp, "Looking up tracks %ld times\n", TRACK_LOOKUPS);
+	fprintf(fp, "Empty loop: %f ns / lookup", empty.ns);
+
+	if (use_tsc) {
+		fprintf(fp, ", %f cycles / lookup", empty.cycles);
+	}
+
+	fprintf(fp, ", subtracted from each timing\n\n");
+
+	for (int keys = 10; keys <= TRACK_MAX_KEYS && status == EXIT_SUCCESS;
+	     keys *= 10)
+	{
+		float spacing = (float) ((double) TRACK_LOOKUPS * td / keys);
+
+		EaseTrackFree(&track);
+
+		for (int k = 0; k < keys; ++k) {
+			if (EaseTrackAddKey(&track, k * spacing, b + c * (k % 2),
+			                    (EaseType) (k % NUM_PENNER_TYPES)) != 0)
+			{
+				fprintf(stderr, "Error allocating %d keys\n", keys);
+				status = EXIT_FAILURE;
+				break;
+			}
+		}
+
+		float end = (keys - 1) * spacing;
+
+		for (int j = 0; j < RANDOM_T_SIZE; ++j) {
+			seek_times[j] = end * ((float) rand() / (float) RAND_MAX);
+		}
+
+		long mismatches = 0;
+
+		for (int mode = 0; mode < 4 && status == EXIT_SUCCESS; ++mode) {
+			int random = (mode >= 2);
+			int cursor = (mode % 2 == 0);
+			double sum;
+			struct timing timing;
+
+			sampler_start(&sampler, &empty);
+
+			do {
+				float t = 0.0f;
+
+				sum = 0.0;
+				track.cursor = 0;
+
+				struct timer timer = timer_start();
+
+				for (long j = 0; j < TRACK_LOOKUPS; ++j) {
+					float time = random? seek_times[j & (RANDOM_T_SIZE - 1)] : t;
+
+					sum += cursor? EaseTrackEval(&track, time) :
+					               EaseTrackSeek(&track, time);
+
+					t += td;
+					if (t > end) {
+						t = 0.0f;
+					}
+				}
+
+				DO_NOT_OPTIMIZE(sum);
+				timing = timer_stop(&timer);
+			} while (sampler_add(&sampler, timing, TRACK_LOOKUPS));
+
+			fprintf(fp, "%d keys %f apart, %s, %s: checksum %.9g\n", keys,
+			            spacing, random? "random seeks" : "every td",
+			            cursor? "cursor" : "binary search", sum);
+			print_samples(fp, &sampler, "lookup", "");
+		}
+
+		for (int j = 0; j < RANDOM_T_SIZE; ++j) {
+			if (EaseTrackEval(&track, seek_times[j]) !=
+			    EaseTrackSeek(&track, seek_times[j]))
+			{
+				mismatches++;
+			}
+		}
+
+		if (mismatches != 0) {
+			fprintf(stderr, "%ld cursor lookups differ from the binary search\n",
+			        mismatches);
+			status = EXIT_FAILURE;
+		}
+
+		fprintf(fp, "\n");
+	}
+
+	EaseTrackFree(&track);
+
+	return status;
+}
+#endif
+
+#if defined(EASINGS_HAS_DISPATCH)
+// Sets the times of the n dispatch items for frame f
+// NOTE: Items are spread over the whole duration, in steps of td from 0 to d
+static void set_dispatch_times(float *t, long n, int f, float d, float td)
+{
+	long steps = (long) (d / td) + 1;
+
+	for (long k = 0; k < n; ++k) {
+		float time = (float) ((f + k) % steps) * td;
+
+		// NOTE: The last step can round past d, where Circ gives NaN
+		t[k] = (time > d)? d : time;
+	}
+}
+
+// Eases the n dispatch items into out, the way mode says
+static void ease_dispatch_frame(enum dispatch_modes mode, const EaseType *types,
+                                const float *t, float *out, long n,
+                                const float *b, const float *c, const float *d,
+                                uint32_t *order)
+{
+	switch (mode) {
+		case DISPATCH_POINTER:
+			for (long k = 0; k < n; ++k) {
+				out[k] = easings[types[k]].func(t[k], b[k], c[k], d[k]);
+			}
+			break;
+		case DISPATCH_SWITCH:
+			for (long k = 0; k < n; ++k) {
+				out[k] = c[k] * EaseCurveU(types[k], t[k] / d[k]) + b[k];
+			}
+			break;
+		case DISPATCH_BUCKETS:
+			EaseDispatchN(types, t, out, n, b, c, d, order);
+			break;
+		default:
+			break;
+	}
+}
+
+// Eases n items of random types for TWEEN_FRAMES frames, calling each item's
+// function pointer, switching on each item's type and with EaseDispatchN(),
+// then checks that the three give the same results
+static int time_dispatch(FILE *fp, long n, float b, float c, float d, float td)
+{
+	EaseType *types = malloc(n * sizeof(EaseType));
+	float *t = malloc(n * sizeof(float));
+	float *b_items = malloc(n * sizeof(float));
+	float *c_items = malloc(n * sizeof(float));
+	float *d_items = malloc(n * sizeof(float));
+	float *out[NUM_DISPATCH_MODES];
+	uint32_t *order = malloc(n * sizeof(uint32_t));
+	long mismatches = 0;
+	int status = EXIT_FAILURE;
+
+	for (enum dispatch_modes mode = 0; mode < NUM_DISPATCH_MODES; ++mode) {
+		out[mode] = malloc(n * sizeof(float));
+	}
+
+	if (types == NULL || t == NULL || b_items == NULL || c_items == NULL ||
+	    d_items == NULL || out[DISPATCH_POINTER] == NULL ||
+	    out[DISPATCH_SWITCH] == NULL || out[DISPATCH_BUCKETS] == NULL ||
+	    order == NULL)
+	{
+		fprintf(stderr, "Error allocating %ld items\n", n);
+		goto end;
+	}
+
+	srand(RANDOM_T_SEED);
+
+	for (long k = 0; k < n; ++k) {
+		types[k] = (EaseType) (rand() % NUM_PENNER_TYPES);
+		b_items[k] = b;
+		c_items[k] = c;
+		d_items[k] = d;
+	}
+
+	// NOTE: Each frame is timed on its own, after setting its times
+	struct timing empty = time_empty_frames(n, TWEEN_FRAMES);
+	struct sampler sampler;
+
+	fprintf(fp, "Easing %ld items of random types, %d frames\n", n,
+	            TWEEN_FRAMES);
+	fprintf(fp, "Empty loop: %f ns / item", empty.ns);
+
+	if (use_tsc) {
+		fprintf(fp, ", %f cycles / item", empty.cycles);
+	}
+
+	fprintf(fp, ", subtracted from each timing\n\n");
+
+	for (enum dispatch_modes mode = 0; mode < NUM_DISPATCH_MODES; ++mode) {
+		struct timing timing;
+
+		sampler_start(&sampler, &empty);
+
+		do {
+			timing = (struct timing) { .ns = 0.0 };
+
+			for (int f = 0; f < TWEEN_FRAMES; ++f) {
+				set_dispatch_times(t, n, f, d, td);
+
+				struct timer timer = timer_start();
+
+				ease_dispatch_frame(mode, types, t, out[mode], n, b_items,
+				                    c_items, d_items, order);
+				DO_NOT_OPTIMIZE(out[mode]);
+
+				timing_add(&timing, timer_stop(&timer));
+			}
+		} while (sampler_add(&sampler, timing, TWEEN_FRAMES * n));
+
+		// NOTE: Not timed, eases the frames again to check and sum the results
+		double checksum = 0.0;
+
+		for (int f = 0; f < TWEEN_FRAMES; ++f) {
+			set_dispatch_times(t, n, f, d, td);
+			ease_dispatch_frame(mode, types, t, out[mode], n, b_items, c_items,
+			                    d_items, order);
+
+			if (mode != DISPATCH_POINTER) {
+				ease_dispatch_frame(DISPATCH_POINTER, types, t,
+				                    out[DISPATCH_POINTER], n, b_items, c_items,
+				                    d_items, order);
+			}
+
+			for (long k = 0; k < n; ++k) {
+				if (out[mode][k] != out[DISPATCH_POINTER][k]) {
+					mismatches++;
+				}
+
+				checksum += out[mode][k];
+			}
+		}
+
+		fprintf(fp, "%s: checksum %.9g\n", dispatch_mode_names[mode],
+		            checksum);
+		print_samples(fp, &sampler, "item", "");
+	}
+
+	fprintf(fp, "\n %ld results differ between the three\n", mismatches);
+
+	status = (mismatches == 0)? EXIT_SUCCESS : EXIT_FAILURE;
+
+end:
+	free(types);
+	free(t);
+	free(b_items);
+	free(c_items);
+	free(d_items);
+	free(order);
+
+	for (enum dispatch_modes mode = 0; mode < NUM_DISPATCH_MODES; ++mode) {
+		free(out[mode]);
+	}
+
+	return status;
+}
+#endif
+
+#if defined(EASINGS_HAS_TWEENS)
+// Sums the targets of the n tweens, which the engine and the aos loop share
+// NOTE: Not timed, the timed loops only sink the targets
+static double checksum_tweens(const struct aos_tween *aos, long n)
+{
+	double checksum = 0.0;
+
+	for (long k = 0; k < n; ++k) {
+		checksum += *aos[k].target;
+	}
+
+	return checksum;
+}
+
+// Updates n tweens of every type for TWEEN_FRAMES frames with the tween engine,
+// then with a loop calling each tween's function pointer, as callers do without it,
+// then with the parallel update for 1 to threads threads, and last replaces
+// n / TWEEN_CHURN_DIV random tweens per frame, timing the removes and adds
+// and counting the allocations they cause
+static int time_tweens(FILE *fp, long n, long threads, float b, float c,
+                       float d, float td)
+{
+	struct aos_tween *aos = malloc(n * sizeof(struct aos_tween));
+	long per_type = (n + NUM_PENNER_TYPES - 1) / NUM_PENNER_TYPES;
+	float *values = NULL;
+	EaseTweenHandle *handles = malloc(n * sizeof(EaseTweenHandle));
+	long churn = (n + TWEEN_CHURN_DIV - 1) / TWEEN_CHURN_DIV;
+	long *churn_k = malloc(churn * sizeof(long));
+	EaseTweenHandle *removed = malloc(churn * sizeof(EaseTweenHandle));
+	EaseTweens tweens;
+	int status = EXIT_FAILURE;
+
+	EaseTweensInit(&tweens);
+
+	// NOTE: Each type's targets start on a cache line, so the parallel update
+	// never has two threads writing to the same line
+	per_type = (per_type + TWEEN_LINE_FLOATS - 1) / TWEEN_LINE_FLOATS *
+	           TWEEN_LINE_FLOATS;
+
+	if (posix_memalign((void **) &values, EASINGS_TWEEN_LINE_SIZE,
+	                   per_type * NUM_PENNER_TYPES * sizeof(float)) != 0)
+	{
+		values = NULL;
+	}
+
+	if (aos == NULL || values == NULL || handles == NULL || churn_k == NULL ||
+	    removed == NULL)
+	{
+		fprintf(stderr, "Error allocating %ld tweens\n", n);
+		goto end;
+	}
+
+	// NOTE: Start times are staggered so every frame has tweens in all stages.
+	// Types are mixed in creation order, but targets are grouped by type: the
+	// engine writes each bucket's targets in order and spreading them over the
+	// whole array costs more than the easings themselves
+	for (long k = 0; k < n; ++k) {
+		enum easing_types type = k % NUM_PENNER_TYPES;
+		float start = (float) (k % TWEEN_FRAMES) * td;
+		float *target = &values[type * per_type + k / NUM_PENNER_TYPES];
+
+		handles[k] = EaseTweenAdd(&tweens, (EaseType) type, start, d, b, c,
+		                          target);
+
+		if (!EaseTweenIsAlive(&tweens, handles[k])) {
+			fprintf(stderr, "Error allocating %ld tweens\n", n);
+			goto end;
+		}
+
+		aos[k].func = easings[type].func;
+		aos[k].start = start;
+		aos[k].b = b;
+		aos[k].c = c;
+		aos[k].d = d;
+		aos[k].target = target;
+	}
+
+	// NOTE: Each frame is timed on its own, like the churn frames below
+	struct timing empty = time_empty_frames(n, TWEEN_FRAMES);
+	struct sampler sampler;
+	struct timing timing;
+
+	fprintf(fp, "Updating %d tweens, %d frames\n", EaseTweensCount(&tweens),
+	            TWEEN_FRAMES);
+	fprintf(fp, "Empty loop: %f ns / tween", empty.ns);
+
+	if (use_tsc) {
+		fprintf(fp, ", %f cycles / tween", empty.cycles);
+	}
+
+	fprintf(fp, ", subtracted from each timing\n\n");
+
+	sampler_start(&sampler, &empty);
+
+	do {
+		timing = (struct timing) { .ns = 0.0 };
+
+		for (int f = 0; f < TWEEN_FRAMES; ++f) {
+			struct timer timer = timer_start();
+
+			EaseTweensUpdate(&tweens, (float) f * td);
+			DO_NOT_OPTIMIZE(values);
+
+			timing_add(&timing, timer_stop(&timer));
+		}
+	} while (sampler_add(&sampler, timing, TWEEN_FRAMES * n));
+
+	fprintf(fp, "soa buckets: checksum %.9g\n", checksum_tweens(aos, n));
+	print_samples(fp, &sampler, "tween", "");
+
+	sampler_start(&sampler, &empty);
+
+	do {
+		timing = (struct timing) { .ns = 0.0 };
+
+		for (int f = 0; f < TWEEN_FRAMES; ++f) {
+			float time = (float) f * td;
+
+			struct timer timer = timer_start();
+
+			for (long k = 0; k < n; ++k) {
+				float e = time - aos[k].start;
+
+				e = (e > aos[k].d)? aos[k].d : ((e < 0.0f)? 0.0f : e);
+				*aos[k].target = aos[k].func(e, aos[k].b, aos[k].c, aos[k].d);
+			}
+
+			DO_NOT_OPTIMIZE(values);
+
+			timing_add(&timing, timer_stop(&timer));
+		}
+	} while (sampler_add(&sampler, timing, TWEEN_FRAMES * n));
+
+	fprintf(fp, "aos function pointers: checksum %.9g\n",
+	            checksum_tweens(aos, n));
+	print_samples(fp, &sampler, "tween", "");
+
+	// NOTE: The timer reads the wall clock, but the counters only count this thread
+	for (long k = 1; k <= threads; ++k) {
+		EaseTweenPool pool;
+
+		if (EaseTweenPoolInit(&pool, (int) k) != 0) {
+			fprintf(stderr, "Error starting %ld threads\n", k);
+			EaseTweenPoolFree(&pool);
+			break;
+		}
+
+		sampler_start(&sampler, &empty);
+
+		do {
+			timing = (struct timing) { .ns = 0.0 };
+
+			for (int f = 0; f < TWEEN_FRAMES; ++f) {
+				struct timer timer = timer_start();
+
+				EaseTweensUpdateParallel(&tweens, &pool, (float) f * td);
+				DO_NOT_OPTIMIZE(values);
+
+				timing_add(&timing, timer_stop(&timer));
+			}
+		} while (sampler_add(&sampler, timing, TWEEN_FRAMES * n));
+
+		EaseTweenPoolFree(&pool);
+
+		fprintf(fp, "soa buckets, %ld threads: checksum %.9g\n", k,
+		            checksum_tweens(aos, n));
+		print_samples(fp, &sampler, "tween", "");
+	}
+
+	// NOTE: A replaced tween keeps its type and target, so buckets keep their
+	// sizes and, after the first frames, removes and adds reuse freed space
+	unsigned long setup_allocations = tweens.allocations;
+	long stale = 0;
+	long replaced = 0;
+
+	empty = time_empty_frames(churn, TWEEN_FRAMES);
+	sampler_start(&sampler, &empty);
+
+	do {
+		timing = (struct timing) { .ns = 0.0 };
+		srand(RANDOM_T_SEED);
+
+		for (int f = 0; f < TWEEN_FRAMES; ++f) {
+			float time = (float) f * td;
+
+			for (long j = 0; j < churn; ++j) {
+				churn_k[j] = (long) (((double) rand() / ((double) RAND_MAX + 1.0)) * n);
+			}
+
+			long failed = 0;
+
+			struct timer timer = timer_start();
+
+			for (long j = 0; j < churn; ++j) {
+				long k = churn_k[j];
+
+				removed[j] = handles[k];
+				EaseTweenRemove(&tweens, removed[j]);
+
+				handles[k] = EaseTweenAdd(&tweens, (EaseType) (k % NUM_PENNER_TYPES),
+				                          time, d, b, c, aos[k].target);
+				failed += (handles[k].generation == 0);
+			}
+
+			DO_NOT_OPTIMIZE(handles);
+
+			timing_add(&timing, timer_stop(&timer));
+
+			if (failed != 0) {
+				fprintf(stderr, "Error allocating %ld tweens\n", failed);
+				goto end;
+			}
+
+			// NOTE: Not timed, the removed tweens' handles must be refused from now on
+			for (long j = 0; j < churn; ++j) {
+				if (EaseTweenRemove(&tweens, removed[j]) != 0) {
+					stale++;
+				}
+			}
+
+			EaseTweensUpdate(&tweens, time);
+			replaced += churn;
+		}
+	} while (sampler_add(&sampler, timing, TWEEN_FRAMES * churn));
+
+	fprintf(fp, "\nReplacing %ld tweens per frame, %d frames\n", churn,
+	            TWEEN_FRAMES);
+	fprintf(fp, "Empty loop: %f ns / remove + add", empty.ns);
+
+	if (use_tsc) {
+		fprintf(fp, ", %f cycles / remove + add", empty.cycles);
+	}
+
+	fprintf(fp, ", subtracted from each timing\n\n");
+	fprintf(fp, "remove + add: checksum %.9g\n", checksum_tweens(aos, n));
+	print_samples(fp, &sampler, "remove + add",
+	              "%lu allocations (%lu in setup), %ld of %ld stale handles refused",
+	              tweens.allocations - setup_allocations, setup_allocations,
+	              stale, replaced);
+
+	status = EXIT_SUCCESS;
+
+end:
+	EaseTweensFree(&tweens);
+	free(aos);
+	free(values);
+	free(handles);
+	free(churn_k);
+	free(removed);
+
+	return status;
 }
+#endif
 
 static int get_float_arg(char *argvi, char *arg_prefix, float min, float max,
                          float *arg_var)
@@ -446,7 +2497,7 @@ static int get_string_arg(char *argvi, char *arg_prefix, char *arg_array,
 	}
 
 	strncpy(arg_array, argvi + prefix_len, max_len - 1);
-	arg_array[max_len] = '\0';
+	arg_array[max_len - 1] = '\0';
 
 	return 0;
 }
\ No newline at end of file
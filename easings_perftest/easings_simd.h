@@ -0,0 +1,256 @@
+/*******************************************************************************************
+*
+*   easings SIMD kernels (header only file)
+*
+*   Hand-written SSE4.1, AVX2 and AVX-512 versions of the easings.h batch functions,
+*   with the widest one supported by the running CPU picked at startup.
+*
+*   How to use:
+*   Include easings.h (with the batch API) and then this file. Kernels are compiled with
+*   per-function target attributes, so no -m flags are needed and a single binary runs on
+*   any x86 CPU. On other architectures or compilers every level falls back to the scalar
+*   EaseXxxN() batch functions.
+*
+*   float t[256], x[256];
+*   EaseSimdN(EASE_TYPE_ELASTIC_OUT, t, x, 256, startX, finalX - startX, duration);
+*
+*   NOTE: Sine, Expo and Elastic kernels use the EaseFastSinf()/EaseFastExp2f() polynomials from
+*   easings.h (a few ULP away from libm), the other families give the same results as easings.h.
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2019 Juan Miguel López
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef EASINGS_SIMD_H
+#define EASINGS_SIMD_H
+
+#include "easings.h"
+
+#if !defined(EASINGS_HAS_BATCH)
+    #error "easings_simd.h requires the easings.h batch API"
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define EASINGS_SIMD_X86
+    #include <immintrin.h>
+#endif
+
+#define EASINGS_HAS_SIMD
+
+typedef void (*EaseBatchFunc)(const float *t, float *out, size_t n, float b, float c, float d);
+
+// Instruction set levels, from narrowest to widest
+typedef enum {
+    EASE_SIMD_SCALAR = 0,   // easings.h EaseXxxN() functions
+    EASE_SIMD_SSE41,        // 4 floats, SSE4.1
+    EASE_SIMD_AVX2,         // 8 floats, AVX2 + FMA
+    EASE_SIMD_AVX512,       // 16 floats, AVX-512F
+    EASE_SIMD_COUNT
+} EaseSimdLevel;
+
+#if defined(EASINGS_SIMD_X86)
+
+// SSE4.1 kernels
+//----------------------------------------------------------------------------------
+#define EASE_SIMD_SUFFIX            sse41
+#define EASE_SIMD_ATTR              __attribute__((target("sse4.1")))
+#define EASE_SIMD_WIDTH             4
+#define VF                          __m128
+#define VI                          __m128i
+#define VM                          __m128
+#define V_SET1(x)                   _mm_set1_ps(x)
+#define V_LOADU(p)                  _mm_loadu_ps(p)
+#define V_STOREU(p, a)              _mm_storeu_ps(p, a)
+#define V_ADD(a, b)                 _mm_add_ps(a, b)
+#define V_SUB(a, b)                 _mm_sub_ps(a, b)
+#define V_MUL(a, b)                 _mm_mul_ps(a, b)
+#define V_DIV(a, b)                 _mm_div_ps(a, b)
+#define V_MADD(a, b, c)             _mm_add_ps(_mm_mul_ps(a, b), c)
+#define V_SQRT(a)                   _mm_sqrt_ps(a)
+#define V_MIN(a, b)                 _mm_min_ps(a, b)
+#define V_MAX(a, b)                 _mm_max_ps(a, b)
+#define V_ROUND(a)                  _mm_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+#define V_CMPLT(a, b)               _mm_cmplt_ps(a, b)
+#define V_CMPEQ(a, b)               _mm_cmpeq_ps(a, b)
+#define V_BLEND(m, a, b)            _mm_blendv_ps(a, b, m)
+#define V_TOINT(a)                  _mm_cvtps_epi32(a)
+#define V_FROMBITS(i)               _mm_castsi128_ps(i)
+#define V_XORBITS(a, i)             _mm_xor_ps(a, _mm_castsi128_ps(i))
+#define VI_SET1(x)                  _mm_set1_epi32(x)
+#define VI_ADD(a, b)                _mm_add_epi32(a, b)
+#define VI_AND(a, b)                _mm_and_si128(a, b)
+#define VI_SLLI(a, n)               _mm_slli_epi32(a, n)
+#define VI_TEST(a, b)               _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(a, b), b))
+#include "easings_simd_kernels.h"
+
+// AVX2 kernels
+//----------------------------------------------------------------------------------
+#define EASE_SIMD_SUFFIX            avx2
+#define EASE_SIMD_ATTR              __attribute__((target("avx2,fma")))
+#define EASE_SIMD_WIDTH             8
+#define VF                          __m256
+#define VI                          __m256i
+#define VM                          __m256
+#define V_SET1(x)                   _mm256_set1_ps(x)
+#define V_LOADU(p)                  _mm256_loadu_ps(p)
+#define V_STOREU(p, a)              _mm256_storeu_ps(p, a)
+#define V_ADD(a, b)                 _mm256_add_ps(a, b)
+#define V_SUB(a, b)                 _mm256_sub_ps(a, b)
+#define V_MUL(a, b)                 _mm256_mul_ps(a, b)
+#define V_DIV(a, b)                 _mm256_div_ps(a, b)
+#define V_MADD(a, b, c)             _mm256_fmadd_ps(a, b, c)
+#define V_SQRT(a)                   _mm256_sqrt_ps(a)
+#define V_MIN(a, b)                 _mm256_min_ps(a, b)
+#define V_MAX(a, b)                 _mm256_max_ps(a, b)
+#define V_ROUND(a)                  _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+#define V_CMPLT(a, b)               _mm256_cmp_ps(a, b, _CMP_LT_OQ)
+#define V_CMPEQ(a, b)               _mm256_cmp_ps(a, b, _CMP_EQ_OQ)
+#define V_BLEND(m, a, b)            _mm256_blendv_ps(a, b, m)
+#define V_TOINT(a)                  _mm256_cvtps_epi32(a)
+#define V_FROMBITS(i)               _mm256_castsi256_ps(i)
+#define V_XORBITS(a, i)             _mm256_xor_ps(a, _mm256_castsi256_ps(i))
+#define VI_SET1(x)                  _mm256_set1_epi32(x)
+#define VI_ADD(a, b)                _mm256_add_epi32(a, b)
+#define VI_AND(a, b)                _mm256_and_si256(a, b)
+#define VI_SLLI(a, n)               _mm256_slli_epi32(a, n)
+#define VI_TEST(a, b)               _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(a, b), b))
+#include "easings_simd_kernels.h"
+
+// AVX-512 kernels
+//----------------------------------------------------------------------------------
+#define EASE_SIMD_SUFFIX            avx512
+#define EASE_SIMD_ATTR              __attribute__((target("avx512f")))
+#define EASE_SIMD_WIDTH             16
+#define VF                          __m512
+#define VI                          __m512i
+#define VM                          __mmask16
+#define V_SET1(x)                   _mm512_set1_ps(x)
+#define V_LOADU(p)                  _mm512_loadu_ps(p)
+#define V_STOREU(p, a)              _mm512_storeu_ps(p, a)
+#define V_ADD(a, b)                 _mm512_add_ps(a, b)
+#define V_SUB(a, b)                 _mm512_sub_ps(a, b)
+#define V_MUL(a, b)                 _mm512_mul_ps(a, b)
+#define V_DIV(a, b)                 _mm512_div_ps(a, b)
+#define V_MADD(a, b, c)             _mm512_fmadd_ps(a, b, c)
+#define V_SQRT(a)                   _mm512_sqrt_ps(a)
+#define V_MIN(a, b)                 _mm512_min_ps(a, b)
+#define V_MAX(a, b)                 _mm512_max_ps(a, b)
+#define V_ROUND(a)                  _mm512_roundscale_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+#define V_CMPLT(a, b)               _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ)
+#define V_CMPEQ(a, b)               _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ)
+#define V_BLEND(m, a, b)            _mm512_mask_blend_ps(m, a, b)
+#define V_TOINT(a)                  _mm512_cvtps_epi32(a)
+#define V_FROMBITS(i)               _mm512_castsi512_ps(i)
+#define V_XORBITS(a, i)             _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), i))
+#define VI_SET1(x)                  _mm512_set1_epi32(x)
+#define VI_ADD(a, b)                _mm512_add_epi32(a, b)
+#define VI_AND(a, b)                _mm512_and_si512(a, b)
+#define VI_SLLI(a, n)               _mm512_slli_epi32(a, n)
+#define VI_TEST(a, b)               _mm512_test_epi32_mask(a, b)
+#include "easings_simd_kernels.h"
+
+#endif // EASINGS_SIMD_X86
+
+// Scalar level, the easings.h batch functions
+static const EaseBatchFunc easeSimdKernels_scalar[EASE_TYPE_COUNT] = {
+    EaseLinearNoneN, EaseLinearInN, EaseLinearOutN, EaseLinearInOutN,
+    EaseSineInN, EaseSineOutN, EaseSineInOutN,
+    EaseCircInN, EaseCircOutN, EaseCircInOutN,
+    EaseCubicInN, EaseCubicOutN, EaseCubicInOutN,
+    EaseQuadInN, EaseQuadOutN, EaseQuadInOutN,
+    EaseExpoInN, EaseExpoOutN, EaseExpoInOutN,
+    EaseBackInN, EaseBackOutN, EaseBackInOutN,
+    EaseBounceOutN, EaseBounceInN, EaseBounceInOutN,
+    EaseElasticInN, EaseElasticOutN, EaseElasticInOutN,
+};
+
+static const EaseBatchFunc *easeSimdKernels[EASE_SIMD_COUNT] = {
+    easeSimdKernels_scalar,
+#if defined(EASINGS_SIMD_X86)
+    easeSimdKernels_sse41,
+    easeSimdKernels_avx2,
+    easeSimdKernels_avx512,
+#else
+    NULL, NULL, NULL,
+#endif
+};
+
+static const EaseBatchFunc *easeSimdActive = easeSimdKernels_scalar;
+static EaseSimdLevel easeSimdActiveLevel = EASE_SIMD_SCALAR;
+
+// Get the widest level supported by the running CPU (and OS)
+static inline EaseSimdLevel EaseSimdDetect(void)
+{
+#if defined(EASINGS_SIMD_X86)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f")) return EASE_SIMD_AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return EASE_SIMD_AVX2;
+    if (__builtin_cpu_supports("sse4.1")) return EASE_SIMD_SSE41;
+#endif
+
+    return EASE_SIMD_SCALAR;
+}
+
+static inline const char *EaseSimdLevelName(EaseSimdLevel level)
+{
+    static const char *names[EASE_SIMD_COUNT] = { "scalar", "sse4.1", "avx2", "avx512" };
+
+    return ((unsigned)level < EASE_SIMD_COUNT)? names[level] : "unknown";
+}
+
+// Get the kernel for an easing at a given level, NULL if the CPU does not support it
+static inline EaseBatchFunc EaseSimdGetFunc(EaseType type, EaseSimdLevel level)
+{
+    if ((unsigned)type >= EASE_TYPE_COUNT || (unsigned)level >= EASE_SIMD_COUNT) return NULL;
+    if (level > EaseSimdDetect() || easeSimdKernels[level] == NULL) return NULL;
+
+    return easeSimdKernels[level][type];
+}
+
+// Select the level used by EaseSimdN(), clamped to the widest one supported
+static inline EaseSimdLevel EaseSimdSetLevel(EaseSimdLevel level)
+{
+    EaseSimdLevel detected = EaseSimdDetect();
+
+    if ((unsigned)level >= EASE_SIMD_COUNT || level > detected) level = detected;
+
+    easeSimdActive = easeSimdKernels[level];
+    easeSimdActiveLevel = level;
+
+    return level;
+}
+
+static inline EaseSimdLevel EaseSimdGetLevel(void) { return easeSimdActiveLevel; }
+
+// NOTE: Runs before main() on GCC/Clang, elsewhere call EaseSimdSetLevel(EASE_SIMD_COUNT)
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((constructor)) static void EaseSimdInit(void) { EaseSimdSetLevel(EASE_SIMD_COUNT); }
+#endif
+
+// Evaluate n values of an easing with the selected kernel (out is left untouched if the type is invalid)
+static inline void EaseSimdN(EaseType type, const float *t, float *out, size_t n, float b, float c, float d)
+{
+    if ((unsigned)type >= EASE_TYPE_COUNT) return;
+
+    easeSimdActive[type](t, out, n, b, c, d);
+}
+
+#endif // EASINGS_SIMD_H
@@ -0,0 +1,398 @@
+/*******************************************************************************************
+*
+*   easings SIMD kernels template, included once per instruction set by easings_simd.h
+*
+*   NOTE: No include guard on purpose. Before including it, define EASE_SIMD_SUFFIX,
+*   EASE_SIMD_ATTR, EASE_SIMD_WIDTH, the VF/VI/VM types and the V_xxx/VI_xxx operations,
+*   they are all undefined at the end of the file.
+*
+*   Kernels work on normalized time u = t/d like the EaseXxxU() curves in easings.h. Rational
+*   and polynomial curves follow their expressions operation by operation (no fused
+*   multiply-add), so they give the same results as the scalar functions.
+*
+**********************************************************************************************/
+
+#ifndef EASE_SIMD_FN
+    #define EASE_SIMD_CAT2(a, b)        a##_##b
+    #define EASE_SIMD_CAT(a, b)         EASE_SIMD_CAT2(a, b)
+    #define EASE_SIMD_FN(name)          EASE_SIMD_CAT(name, EASE_SIMD_SUFFIX)
+    #define K(x)                        V_SET1(x)
+
+    // Batch loop around a normalized kernel, c*f(t/d) + b like the scalar functions. The tail
+    // is padded so every element goes through the same kernel
+    #define EASE_SIMD_DEFINE_BATCH(func) \
+        EASE_SIMD_ATTR static void EASE_SIMD_FN(func##N)(const float *t, float *out, size_t n, \
+                                                         float b, float c, float d) \
+        { \
+            const VF vb = V_SET1(b); \
+            const VF vc = V_SET1(c); \
+            const VF vd = V_SET1(d); \
+            size_t i = 0; \
+            \
+            for (; i + EASE_SIMD_WIDTH <= n; i += EASE_SIMD_WIDTH) \
+            { \
+                VF u = V_DIV(V_LOADU(t + i), vd); \
+                V_STOREU(out + i, V_ADD(V_MUL(vc, EASE_SIMD_FN(func##UV)(u)), vb)); \
+            } \
+            \
+            if (i < n) \
+            { \
+                float tailT[EASE_SIMD_WIDTH] = { 0.0f }; \
+                float tailOut[EASE_SIMD_WIDTH]; \
+                \
+                for (size_t j = 0; j < n - i; j++) tailT[j] = t[i + j]; \
+                VF u = V_DIV(V_LOADU(tailT), vd); \
+                V_STOREU(tailOut, V_ADD(V_MUL(vc, EASE_SIMD_FN(func##UV)(u)), vb)); \
+                for (size_t j = 0; j < n - i; j++) out[i + j] = tailOut[j]; \
+            } \
+        }
+#endif
+
+// Math helpers
+//----------------------------------------------------------------------------------
+
+// sin(x) for quadrant = 0, cos(x) for quadrant = 1
+// NOTE: x is reduced to [-PI/4, PI/4] around the nearest multiple of PI/2, same error bounds as
+// EaseFastSinCosf() for |x| <= 64*PI but there is no libm fallback for larger inputs
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseSimdSinCos)(VF x, int quadrant)
+{
+    VF j = V_ROUND(V_MUL(x, K(2.0f/PI)));
+    VF r = V_SUB(x, V_MUL(j, K(EASINGS_FAST_PIO2_1)));
+    r = V_SUB(r, V_MUL(j, K(EASINGS_FAST_PIO2_2)));
+    r = V_SUB(r, V_MUL(j, K(EASINGS_FAST_PIO2_3)));
+
+    VI q = VI_ADD(V_TOINT(j), VI_SET1(quadrant));
+    VF z = V_MUL(r, r);
+
+    VF ps = V_MADD(V_MADD(V_MADD(K(EASINGS_FAST_SIN_C7), z, K(EASINGS_FAST_SIN_C5)), z, K(EASINGS_FAST_SIN_C3)), V_MUL(z, r), r);
+    VF pc = V_MADD(V_MADD(V_MADD(K(EASINGS_FAST_COS_C8), z, K(EASINGS_FAST_COS_C6)), z, K(EASINGS_FAST_COS_C4)), V_MUL(z, z),
+                   V_SUB(K(1.0f), V_MUL(K(0.5f), z)));
+
+    // Quadrants 1 and 3 use the cosine polynomial, quadrants 2 and 3 flip the sign
+    VF y = V_BLEND(VI_TEST(q, VI_SET1(1)), ps, pc);
+
+    return V_XORBITS(y, VI_SLLI(VI_AND(q, VI_SET1(2)), 30));
+}
+
+// 2^x, the integer part goes straight into the exponent bits
+// NOTE: Results under 2^-127 are flushed to 0.0f and results over 2^127.5 give +inf
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseSimdExp2)(VF x)
+{
+    x = V_MIN(V_MAX(x, K(-127.0f)), K(128.0f));
+
+    VF n = V_ROUND(x);
+    VF f = V_SUB(x, n);
+    VF p = V_MADD(V_MADD(K(EASINGS_FAST_EXP2_C6), f, K(EASINGS_FAST_EXP2_C5)), f, K(EASINGS_FAST_EXP2_C4));
+    p = V_MADD(V_MADD(V_MADD(p, f, K(EASINGS_FAST_EXP2_C3)), f, K(EASINGS_FAST_EXP2_C2)), f, K(EASINGS_FAST_EXP2_C1));
+    p = V_MADD(p, f, K(1.0f));
+
+    VI e = VI_SLLI(VI_ADD(V_TOINT(n), VI_SET1(127)), 23);
+
+    return V_MUL(p, V_FROMBITS(e));
+}
+
+// Linear Easing kernels
+//----------------------------------------------------------------------------------
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseLinearNoneUV)(VF u) { return u; }
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseLinearInUV)(VF u) { return u; }
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseLinearOutUV)(VF u) { return u; }
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseLinearInOutUV)(VF u) { return u; }
+
+// Sine Easing kernels
+//----------------------------------------------------------------------------------
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseSineInUV)(VF u)
+{
+    return V_SUB(K(1.0f), EASE_SIMD_FN(EaseSimdSinCos)(V_MUL(u, K(PI/2.0f)), 1));
+}
+
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseSineOutUV)(VF u)
+{
+    return EASE_SIMD_FN(EaseSimdSinCos)(V_MUL(u, K(PI/2.0f)), 0);
+}
+
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseSineInOutUV)(VF u)
+{
+    VF cs = EASE_SIMD_FN(EaseSimdSinCos)(V_MUL(K(PI), u), 1);
+    return V_MUL(K(-0.5f), V_SUB(cs, K(1.0f)));
+}
+
+// Circular Easing kernels
+//----------------------------------------------------------------------------------
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseCircInUV)(VF u)
+{
+    return V_SUB(K(1.0f), V_SQRT(V_SUB(K(1.0f), V_MUL(u, u))));
+}
+
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseCircOutUV)(VF u)
+{
+    u = V_SUB(u, K(1.0f));
+    return V_SQRT(V_SUB(K(1.0f), V_MUL(u, u)));
+}
+
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseCircInOutUV)(VF u)
+{
+    u = V_MUL(u, K(2.0f));
+    VM first = V_CMPLT(u, K(1.0f));
+    u = V_BLEND(first, V_SUB(u, K(2.0f)), u);
+
+    VF sq = V_SQRT(V_SUB(K(1.0f), V_MUL(u, u)));
+    VF r1 = V_MUL(K(-0.5f), V_SUB(sq, K(1.0f)));
+    VF r2 = V_MUL(K(0.5f), V_ADD(sq, K(1.0f)));
+
+    return V_BLEND(first, r2, r1);
+}
+
+// Cubic Easing kernels
+//----------------------------------------------------------------------------------
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseCubicInUV)(VF u) { return V_MUL(V_MUL(u, u), u); }
+
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseCubicOutUV)(VF u)
+{
+    u = V_SUB(u, K(1.0f));
+    return V_ADD(V_MUL(V_MUL(u, u), u), K(1.0f));
+}
+
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseCubicInOutUV)(VF u)
+{
+    u = V_MUL(u, K(2.0f));
+    VM first = V_CMPLT(u, K(1.0f));
+
+    VF r1 = V_MUL(V_MUL(V_MUL(K(0.5f), u), u), u);
+    u = V_SUB(u, K(2.0f));
+    VF r2 = V_MUL(K(0.5f), V_ADD(V_MUL(V_MUL(u, u), u), K(2.0f)));
+
+    return V_BLEND(first, r2, r1);
+}
+
+// Quadratic Easing kernels
+//----------------------------------------------------------------------------------
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseQuadInUV)(VF u) { return V_MUL(u, u); }
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseQuadOutUV)(VF u) { return V_MUL(V_SUB(K(0.0f), u), V_SUB(u, K(2.0f))); }
+
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseQuadInOutUV)(VF u)
+{
+    u = V_MUL(u, K(2.0f));
+    VM first = V_CMPLT(u, K(1.0f));
+
+    VF r1 = V_MUL(K(0.5f), V_MUL(u, u));
+    VF r2 = V_MUL(K(-0.5f), V_SUB(V_MUL(V_SUB(u, K(1.0f)), V_SUB(u, K(3.0f))), K(1.0f)));
+
+    return V_BLEND(first, r2, r1);
+}
+
+// Exponential Easing kernels
+//----------------------------------------------------------------------------------
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseExpoInUV)(VF u)
+{
+    VF e = EASE_SIMD_FN(EaseSimdExp2)(V_MUL(K(10.0f), V_SUB(u, K(1.0f))));
+    return V_BLEND(V_CMPEQ(u, K(0.0f)), e, K(0.0f));
+}
+
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseExpoOutUV)(VF u)
+{
+    VF e = EASE_SIMD_FN(EaseSimdExp2)(V_MUL(K(-10.0f), u));
+    return V_BLEND(V_CMPEQ(u, K(1.0f)), V_ADD(V_SUB(K(0.0f), e), K(1.0f)), K(1.0f));
+}
+
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseExpoInOutUV)(VF u)
+{
+    VF u2 = V_MUL(u, K(2.0f));
+    VM first = V_CMPLT(u2, K(1.0f));
+    VF x = V_MUL(K(10.0f), V_SUB(u2, K(1.0f)));
+    VF e = EASE_SIMD_FN(EaseSimdExp2)(V_BLEND(first, V_SUB(K(0.0f), x), x));
+
+    VF r = V_BLEND(first, V_MUL(K(0.5f), V_ADD(V_SUB(K(0.0f), e), K(2.0f))), V_MUL(K(0.5f), e));
+    r = V_BLEND(V_CMPEQ(u, K(1.0f)), r, K(1.0f));
+
+    return V_BLEND(V_CMPEQ(u, K(0.0f)), r, K(0.0f));
+}
+
+// Back Easing kernels
+//----------------------------------------------------------------------------------
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseBackInUV)(VF u)
+{
+    const float s = 1.70158f;
+    return V_MUL(V_MUL(u, u), V_SUB(V_MUL(K(s + 1.0f), u), K(s)));
+}
+
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseBackOutUV)(VF u)
+{
+    const float s = 1.70158f;
+    u = V_SUB(u, K(1.0f));
+    return V_ADD(V_MUL(V_MUL(u, u), V_ADD(V_MUL(K(s + 1.0f), u), K(s))), K(1.0f));
+}
+
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseBackInOutUV)(VF u)
+{
+    const float s = 1.70158f*1.525f;
+
+    u = V_MUL(u, K(2.0f));
+    VM first = V_CMPLT(u, K(1.0f));
+
+    VF r1 = V_MUL(K(0.5f), V_MUL(V_MUL(u, u), V_SUB(V_MUL(K(s + 1.0f), u), K(s))));
+    u = V_SUB(u, K(2.0f));
+    VF r2 = V_MUL(K(0.5f), V_ADD(V_MUL(V_MUL(u, u), V_ADD(V_MUL(K(s + 1.0f), u), K(s))), K(2.0f)));
+
+    return V_BLEND(first, r2, r1);
+}
+
+// Bounce Easing kernels
+//----------------------------------------------------------------------------------
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseBounceOutUV)(VF u)
+{
+    // Pick the parabola offset and height of each bounce, from the last one backwards
+    VF offset = K(2.625f/2.75f);
+    VF height = K(0.984375f);
+    VM m = V_CMPLT(u, K(2.5/2.75));
+    offset = V_BLEND(m, offset, K(2.25f/2.75f));
+    height = V_BLEND(m, height, K(0.9375f));
+    m = V_CMPLT(u, K(2.0f/2.75f));
+    offset = V_BLEND(m, offset, K(1.5f/2.75f));
+    height = V_BLEND(m, height, K(0.75f));
+    m = V_CMPLT(u, K(1.0f/2.75f));
+    offset = V_BLEND(m, offset, K(0.0f));
+    height = V_BLEND(m, height, K(0.0f));
+
+    u = V_SUB(u, offset);
+
+    return V_ADD(V_MUL(V_MUL(K(7.5625f), u), u), height);
+}
+
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseBounceInUV)(VF u)
+{
+    return V_SUB(K(1.0f), EASE_SIMD_FN(EaseBounceOutUV)(V_SUB(K(1.0f), u)));
+}
+
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseBounceInOutUV)(VF u)
+{
+    // First half is EaseBounceInU(2u) = 1 - EaseBounceOutU(1 - 2u), so one EaseBounceOutU covers both
+    VM first = V_CMPLT(u, K(0.5f));
+    VF u2 = V_MUL(u, K(2.0f));
+    VF o = EASE_SIMD_FN(EaseBounceOutUV)(V_BLEND(first, V_SUB(u2, K(1.0f)), V_SUB(K(1.0f), u2)));
+
+    VF r1 = V_MUL(V_SUB(K(1.0f), o), K(0.5f));
+    VF r2 = V_ADD(V_MUL(o, K(0.5f)), K(0.5f));
+
+    return V_BLEND(first, r2, r1);
+}
+
+// Elastic Easing kernels
+//----------------------------------------------------------------------------------
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseElasticInUV)(VF u)
+{
+    const float p = 0.3f;
+    const float s = p/4.0f;
+    VF v = V_SUB(u, K(1.0f));
+    VF e = EASE_SIMD_FN(EaseSimdExp2)(V_MUL(K(10.0f), v));
+    VF sn = EASE_SIMD_FN(EaseSimdSinCos)(V_DIV(V_MUL(V_SUB(v, K(s)), K(2.0f*PI)), K(p)), 0);
+
+    VF r = V_SUB(K(0.0f), V_MUL(e, sn));
+    r = V_BLEND(V_CMPEQ(u, K(1.0f)), r, K(1.0f));
+
+    return V_BLEND(V_CMPEQ(u, K(0.0f)), r, K(0.0f));
+}
+
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseElasticOutUV)(VF u)
+{
+    const float p = 0.3f;
+    const float s = p/4.0f;
+    VF e = EASE_SIMD_FN(EaseSimdExp2)(V_MUL(K(-10.0f), u));
+    VF sn = EASE_SIMD_FN(EaseSimdSinCos)(V_DIV(V_MUL(V_SUB(u, K(s)), K(2.0f*PI)), K(p)), 0);
+
+    VF r = V_ADD(V_MUL(e, sn), K(1.0f));
+    r = V_BLEND(V_CMPEQ(u, K(1.0f)), r, K(1.0f));
+
+    return V_BLEND(V_CMPEQ(u, K(0.0f)), r, K(0.0f));
+}
+
+EASE_SIMD_ATTR static inline VF EASE_SIMD_FN(EaseElasticInOutUV)(VF u)
+{
+    const float p = 0.3f*1.5f;
+    const float s = p/4.0f;
+    VF u2 = V_MUL(u, K(2.0f));
+    VM first = V_CMPLT(u2, K(1.0f));
+    VF v = V_SUB(u2, K(1.0f));
+    VF x = V_MUL(K(10.0f), v);
+    VF e = EASE_SIMD_FN(EaseSimdExp2)(V_BLEND(first, V_SUB(K(0.0f), x), x));
+    VF sn = EASE_SIMD_FN(EaseSimdSinCos)(V_DIV(V_MUL(V_SUB(v, K(s)), K(2.0f*PI)), K(p)), 0);
+
+    VF r1 = V_MUL(K(-0.5f), V_MUL(e, sn));
+    VF r2 = V_ADD(V_MUL(V_MUL(e, sn), K(0.5f)), K(1.0f));
+    VF r = V_BLEND(first, r2, r1);
+    r = V_BLEND(V_CMPEQ(u2, K(2.0f)), r, K(1.0f));
+
+    return V_BLEND(V_CMPEQ(u, K(0.0f)), r, K(0.0f));
+}
+
+// Batch functions and kernel table
+//----------------------------------------------------------------------------------
+EASE_SIMD_DEFINE_BATCH(EaseLinearNone)
+EASE_SIMD_DEFINE_BATCH(EaseLinearIn)
+EASE_SIMD_DEFINE_BATCH(EaseLinearOut)
+EASE_SIMD_DEFINE_BATCH(EaseLinearInOut)
+EASE_SIMD_DEFINE_BATCH(EaseSineIn)
+EASE_SIMD_DEFINE_BATCH(EaseSineOut)
+EASE_SIMD_DEFINE_BATCH(EaseSineInOut)
+EASE_SIMD_DEFINE_BATCH(EaseCircIn)
+EASE_SIMD_DEFINE_BATCH(EaseCircOut)
+EASE_SIMD_DEFINE_BATCH(EaseCircInOut)
+EASE_SIMD_DEFINE_BATCH(EaseCubicIn)
+EASE_SIMD_DEFINE_BATCH(EaseCubicOut)
+EASE_SIMD_DEFINE_BATCH(EaseCubicInOut)
+EASE_SIMD_DEFINE_BATCH(EaseQuadIn)
+EASE_SIMD_DEFINE_BATCH(EaseQuadOut)
+EASE_SIMD_DEFINE_BATCH(EaseQuadInOut)
+EASE_SIMD_DEFINE_BATCH(EaseExpoIn)
+EASE_SIMD_DEFINE_BATCH(EaseExpoOut)
+EASE_SIMD_DEFINE_BATCH(EaseExpoInOut)
+EASE_SIMD_DEFINE_BATCH(EaseBackIn)
+EASE_SIMD_DEFINE_BATCH(EaseBackOut)
+EASE_SIMD_DEFINE_BATCH(EaseBackInOut)
+EASE_SIMD_DEFINE_BATCH(EaseBounceOut)
+EASE_SIMD_DEFINE_BATCH(EaseBounceIn)
+EASE_SIMD_DEFINE_BATCH(EaseBounceInOut)
+EASE_SIMD_DEFINE_BATCH(EaseElasticIn)
+EASE_SIMD_DEFINE_BATCH(EaseElasticOut)
+EASE_SIMD_DEFINE_BATCH(EaseElasticInOut)
+
+static const EaseBatchFunc EASE_SIMD_FN(easeSimdKernels)[EASE_TYPE_COUNT] = {
+    EASE_SIMD_FN(EaseLinearNoneN), EASE_SIMD_FN(EaseLinearInN), EASE_SIMD_FN(EaseLinearOutN), EASE_SIMD_FN(EaseLinearInOutN),
+    EASE_SIMD_FN(EaseSineInN), EASE_SIMD_FN(EaseSineOutN), EASE_SIMD_FN(EaseSineInOutN),
+    EASE_SIMD_FN(EaseCircInN), EASE_SIMD_FN(EaseCircOutN), EASE_SIMD_FN(EaseCircInOutN),
+    EASE_SIMD_FN(EaseCubicInN), EASE_SIMD_FN(EaseCubicOutN), EASE_SIMD_FN(EaseCubicInOutN),
+    EASE_SIMD_FN(EaseQuadInN), EASE_SIMD_FN(EaseQuadOutN), EASE_SIMD_FN(EaseQuadInOutN),
+    EASE_SIMD_FN(EaseExpoInN), EASE_SIMD_FN(EaseExpoOutN), EASE_SIMD_FN(EaseExpoInOutN),
+    EASE_SIMD_FN(EaseBackInN), EASE_SIMD_FN(EaseBackOutN), EASE_SIMD_FN(EaseBackInOutN),
+    EASE_SIMD_FN(EaseBounceOutN), EASE_SIMD_FN(EaseBounceInN), EASE_SIMD_FN(EaseBounceInOutN),
+    EASE_SIMD_FN(EaseElasticInN), EASE_SIMD_FN(EaseElasticOutN), EASE_SIMD_FN(EaseElasticInOutN),
+};
+
+#undef EASE_SIMD_SUFFIX
+#undef EASE_SIMD_ATTR
+#undef EASE_SIMD_WIDTH
+#undef VF
+#undef VI
+#undef VM
+#undef V_SET1
+#undef V_LOADU
+#undef V_STOREU
+#undef V_ADD
+#undef V_SUB
+#undef V_MUL
+#undef V_DIV
+#undef V_MADD
+#undef V_SQRT
+#undef V_MIN
+#undef V_MAX
+#undef V_ROUND
+#undef V_CMPLT
+#undef V_CMPEQ
+#undef V_BLEND
+#undef V_TOINT
+#undef V_FROMBITS
+#undef V_XORBITS
+#undef VI_SET1
+#undef VI_ADD
+#undef VI_AND
+#undef VI_SLLI
+#undef VI_TEST
@@ -0,0 +1,821 @@
+/*******************************************************************************************
+*
+*   easings tween engine (header only file)
+*
+*   Keeps many running tweens and updates all of them once per frame. Tweens are stored as
+*   structure of arrays, one bucket per easing type, so a frame runs one tight loop per type
+*   with the normalized curve of easings.h inlined (no call per tween).
+*
+*   How to use:
+*   EaseTweens tweens;
+*   EaseTweensInit(&tweens);
+*
+*   EaseTweenHandle tween = EaseTweenAdd(&tweens, EASE_TYPE_ELASTIC_OUT, startTime, duration,
+*                                        startX, finalX - startX, &x);
+*
+*   while (running)
+*   {
+*       EaseTweensUpdate(&tweens, currentTime);        // Writes every tween value to its target
+*       EaseTweensRemoveFinished(&tweens, currentTime);
+*   }
+*
+*   EaseTweenRemove(&tweens, tween);   // Returns -1 if the tween was already removed
+*   EaseTweensFree(&tweens);
+*
+*   NOTE: Before its start time a tween writes b, after start + duration it writes b + c.
+*   Tweens are not ordered inside a bucket, removing one moves the last one of its bucket into
+*   its place, so buckets stay dense. Handles go through a slot table (allocated in fixed blocks,
+*   free slots kept in a list) with a generation per slot, so stale handles are detected. Once
+*   buckets reach their peak size, adding and removing tweens does no allocation.
+*
+*   Keyframe tracks chain eased segments, the value at any time is found from a cached cursor:
+*
+*   EaseTrack track;
+*   EaseTrackInit(&track);
+*   EaseTrackAddKey(&track, 0.0f, startX, EASE_TYPE_QUAD_OUT);      // Eases from this key to the next
+*   EaseTrackAddKey(&track, 1.0f, middleX, EASE_TYPE_BOUNCE_OUT);
+*   EaseTrackAddKey(&track, 2.5f, finalX, EASE_TYPE_LINEAR_NONE);   // Last key type is not used
+*   x = EaseTrackEval(&track, currentTime);
+*   EaseTrackFree(&track);
+*
+*   With EASINGS_TWEEN_THREADS defined (pthreads, link with -pthread), EaseTweensUpdateParallel()
+*   spreads the update over the threads of an EaseTweenPool, see EaseTweenPoolInit().
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2019 Juan Miguel López
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef EASINGS_TWEEN_H
+#define EASINGS_TWEEN_H
+
+#include "easings.h"
+
+#if !defined(EASINGS_HAS_CURVES)
+    #error "easings_tween.h requires the easings.h normalized curves"
+#endif
+
+#define EASINGS_HAS_TWEENS
+
+#define EASINGS_TWEEN_MIN_CAPACITY      256
+#define EASINGS_TWEEN_BLOCK_SIZE        16384       // Handle slots per block
+#define EASINGS_TWEEN_MAX_BLOCKS        4096
+#define EASINGS_TWEEN_LINE_SIZE         64          // Cache line size, see EaseTweensUpdateParallel()
+
+// Tweens of one easing type, as structure of arrays
+typedef struct EaseTweenBucket {
+    int count;
+    int capacity;
+    float *start;       // Start time
+    float *d;           // Duration
+    float *invD;        // 1.0f/d
+    float *b;           // Starting value
+    float *c;           // Total change in value
+    float **target;     // Where each value is written
+    int *slot;          // Handle slot of each tween
+} EaseTweenBucket;
+
+// Handle slot, telling where a tween is stored
+// NOTE: generation is bumped when the tween is removed, so old handles to the slot stop matching.
+// Free slots are chained through index
+typedef struct EaseTweenSlot {
+    unsigned int generation;
+    int type;
+    int index;          // Position in the bucket, or next free slot
+} EaseTweenSlot;
+
+// Reference to a tween that can be checked after the tween is gone
+// NOTE: A zeroed handle is never valid, generations start at 1
+typedef struct EaseTweenHandle {
+    int slot;
+    unsigned int generation;
+} EaseTweenHandle;
+
+typedef struct EaseTweens {
+    EaseTweenBucket buckets[EASE_TYPE_COUNT];
+    EaseTweenSlot *blocks[EASINGS_TWEEN_MAX_BLOCKS];    // Slot blocks, allocated once and never moved
+    int blockCount;
+    int freeSlot;                                       // First free slot, -1 if none
+    unsigned long allocations;                          // malloc()/realloc() calls so far
+} EaseTweens;
+
+typedef void (*EaseTweenUpdateFunc)(const EaseTweenBucket *bucket, float time, int begin, int end);
+
+// Per type update loops, over tweens [begin, end) of a bucket
+// NOTE: u is computed like EasePreparedEval(), so a finished tween gets exactly b + c. Values go
+// through a small local buffer before being written to their targets, so the curve loop has
+// no scattered stores and can be vectorized
+#define EASINGS_TWEEN_CHUNK             256
+
+#define EASINGS_TWEEN_DEFINE(func) \
+    static void func##Tweens(const EaseTweenBucket *bucket, float time, int begin, int end) \
+    { \
+        float value[EASINGS_TWEEN_CHUNK]; \
+        \
+        for (int first = begin; first < end; first += EASINGS_TWEEN_CHUNK) \
+        { \
+            int n = ((end - first) < EASINGS_TWEEN_CHUNK)? (end - first) : EASINGS_TWEEN_CHUNK; \
+            const float *EASINGS_RESTRICT start = bucket->start + first; \
+            const float *EASINGS_RESTRICT d = bucket->d + first; \
+            const float *EASINGS_RESTRICT invD = bucket->invD + first; \
+            const float *EASINGS_RESTRICT b = bucket->b + first; \
+            const float *EASINGS_RESTRICT c = bucket->c + first; \
+            float *const *target = bucket->target + first; \
+            \
+            for (int i = 0; i < n; i++) \
+            { \
+                float e = time - start[i]; \
+                float u = (e >= d[i])? 1.0f : e*invD[i]; \
+                u = (u > 0.0f)? u : 0.0f; \
+                value[i] = c[i]*func##U(u) + b[i]; \
+            } \
+            \
+            for (int i = 0; i < n; i++) *target[i] = value[i]; \
+        } \
+    }
+
+EASINGS_TWEEN_DEFINE(EaseLinearNone)
+EASINGS_TWEEN_DEFINE(EaseLinearIn)
+EASINGS_TWEEN_DEFINE(EaseLinearOut)
+EASINGS_TWEEN_DEFINE(EaseLinearInOut)
+EASINGS_TWEEN_DEFINE(EaseSineIn)
+EASINGS_TWEEN_DEFINE(EaseSineOut)
+EASINGS_TWEEN_DEFINE(EaseSineInOut)
+EASINGS_TWEEN_DEFINE(EaseCircIn)
+EASINGS_TWEEN_DEFINE(EaseCircOut)
+EASINGS_TWEEN_DEFINE(EaseCircInOut)
+EASINGS_TWEEN_DEFINE(EaseCubicIn)
+EASINGS_TWEEN_DEFINE(EaseCubicOut)
+EASINGS_TWEEN_DEFINE(EaseCubicInOut)
+EASINGS_TWEEN_DEFINE(EaseQuadIn)
+EASINGS_TWEEN_DEFINE(EaseQuadOut)
+EASINGS_TWEEN_DEFINE(EaseQuadInOut)
+EASINGS_TWEEN_DEFINE(EaseExpoIn)
+EASINGS_TWEEN_DEFINE(EaseExpoOut)
+EASINGS_TWEEN_DEFINE(EaseExpoInOut)
+EASINGS_TWEEN_DEFINE(EaseBackIn)
+EASINGS_TWEEN_DEFINE(EaseBackOut)
+EASINGS_TWEEN_DEFINE(EaseBackInOut)
+EASINGS_TWEEN_DEFINE(EaseBounceOut)
+EASINGS_TWEEN_DEFINE(EaseBounceIn)
+EASINGS_TWEEN_DEFINE(EaseBounceInOut)
+EASINGS_TWEEN_DEFINE(EaseElasticIn)
+EASINGS_TWEEN_DEFINE(EaseElasticOut)
+EASINGS_TWEEN_DEFINE(EaseElasticInOut)
+
+static const EaseTweenUpdateFunc easeTweenUpdateFuncs[EASE_TYPE_COUNT] = {
+    EaseLinearNoneTweens, EaseLinearInTweens, EaseLinearOutTweens, EaseLinearInOutTweens,
+    EaseSineInTweens, EaseSineOutTweens, EaseSineInOutTweens,
+    EaseCircInTweens, EaseCircOutTweens, EaseCircInOutTweens,
+    EaseCubicInTweens, EaseCubicOutTweens, EaseCubicInOutTweens,
+    EaseQuadInTweens, EaseQuadOutTweens, EaseQuadInOutTweens,
+    EaseExpoInTweens, EaseExpoOutTweens, EaseExpoInOutTweens,
+    EaseBackInTweens, EaseBackOutTweens, EaseBackInOutTweens,
+    EaseBounceOutTweens, EaseBounceInTweens, EaseBounceInOutTweens,
+    EaseElasticInTweens, EaseElasticOutTweens, EaseElasticInOutTweens,
+};
+
+static inline void EaseTweensInit(EaseTweens *tweens)
+{
+    memset(tweens, 0, sizeof(*tweens));
+    tweens->freeSlot = -1;
+}
+
+static inline void EaseTweensFree(EaseTweens *tweens)
+{
+    for (int i = 0; i < EASE_TYPE_COUNT; i++)
+    {
+        EaseTweenBucket *bucket = &tweens->buckets[i];
+
+        free(bucket->start);
+        free(bucket->d);
+        free(bucket->invD);
+        free(bucket->b);
+        free(bucket->c);
+        free(bucket->target);
+        free(bucket->slot);
+    }
+
+    for (int i = 0; i < tweens->blockCount; i++) free(tweens->blocks[i]);
+
+    EaseTweensInit(tweens);
+}
+
+// Grows the arrays of a bucket to hold at least capacity tweens, returns 0 on success
+// NOTE: Arrays only grow (doubling), so once a bucket has seen its peak count adding and
+// removing tweens no longer allocates
+static inline int EaseTweenBucketReserve(EaseTweenBucket *bucket, int capacity, unsigned long *allocations)
+{
+    if (capacity <= bucket->capacity) return 0;
+
+    int size = (bucket->capacity < EASINGS_TWEEN_MIN_CAPACITY)? EASINGS_TWEEN_MIN_CAPACITY : bucket->capacity;
+    while (size < capacity) size *= 2;
+
+    // NOTE: Arrays already grown stay valid if a later one fails, capacity is only updated at the end
+    *allocations += 7;
+
+    float *start = (float *)realloc(bucket->start, size*sizeof(float));
+    if (start == NULL) return -1;
+    bucket->start = start;
+
+    float *d = (float *)realloc(bucket->d, size*sizeof(float));
+    if (d == NULL) return -1;
+    bucket->d = d;
+
+    float *invD = (float *)realloc(bucket->invD, size*sizeof(float));
+    if (invD == NULL) return -1;
+    bucket->invD = invD;
+
+    float *b = (float *)realloc(bucket->b, size*sizeof(float));
+    if (b == NULL) return -1;
+    bucket->b = b;
+
+    float *c = (float *)realloc(bucket->c, size*sizeof(float));
+    if (c == NULL) return -1;
+    bucket->c = c;
+
+    float **target = (float **)realloc(bucket->target, size*sizeof(float *));
+    if (target == NULL) return -1;
+    bucket->target = target;
+
+    int *slot = (int *)realloc(bucket->slot, size*sizeof(int));
+    if (slot == NULL) return -1;
+    bucket->slot = slot;
+
+    bucket->capacity = size;
+
+    return 0;
+}
+
+static inline EaseTweenSlot *EaseTweenGetSlot(const EaseTweens *tweens, int slot)
+{
+    return &tweens->blocks[slot/EASINGS_TWEEN_BLOCK_SIZE][slot%EASINGS_TWEEN_BLOCK_SIZE];
+}
+
+// Takes a slot from the free list, adding a block of them if it is empty (-1 if it can't)
+static inline int EaseTweenNewSlot(EaseTweens *tweens)
+{
+    if (tweens->freeSlot < 0)
+    {
+        if (tweens->blockCount == EASINGS_TWEEN_MAX_BLOCKS) return -1;
+
+        EaseTweenSlot *block = (EaseTweenSlot *)malloc(EASINGS_TWEEN_BLOCK_SIZE*sizeof(EaseTweenSlot));
+        tweens->allocations++;
+
+        if (block == NULL) return -1;
+
+        int first = tweens->blockCount*EASINGS_TWEEN_BLOCK_SIZE;
+
+        for (int i = 0; i < EASINGS_TWEEN_BLOCK_SIZE; i++)
+        {
+            block[i].generation = 1;
+            block[i].type = -1;
+            block[i].index = (i < EASINGS_TWEEN_BLOCK_SIZE - 1)? first + i + 1 : -1;
+        }
+
+        tweens->blocks[tweens->blockCount++] = block;
+        tweens->freeSlot = first;
+    }
+
+    int slot = tweens->freeSlot;
+    tweens->freeSlot = EaseTweenGetSlot(tweens, slot)->index;
+
+    return slot;
+}
+
+// Adds a tween running from time start for d time units
+// NOTE: Returns a zeroed (never valid) handle if it can't be stored
+static inline EaseTweenHandle EaseTweenAdd(EaseTweens *tweens, EaseType type, float start, float d, float b, float c, float *target)
+{
+    EaseTweenHandle handle = { 0 };
+    EaseTweenBucket *bucket = &tweens->buckets[type];
+
+    if (EaseTweenBucketReserve(bucket, bucket->count + 1, &tweens->allocations) != 0) return handle;
+
+    int slot = EaseTweenNewSlot(tweens);
+    if (slot < 0) return handle;
+
+    int i = bucket->count++;
+
+    bucket->start[i] = start;
+    bucket->d[i] = d;
+    bucket->invD[i] = 1.0f/d;
+    bucket->b[i] = b;
+    bucket->c[i] = c;
+    bucket->target[i] = target;
+    bucket->slot[i] = slot;
+
+    EaseTweenSlot *s = EaseTweenGetSlot(tweens, slot);
+    s->type = type;
+    s->index = i;
+
+    handle.slot = slot;
+    handle.generation = s->generation;
+
+    return handle;
+}
+
+// Checks that the tween of a handle has not been removed
+static inline int EaseTweenIsAlive(const EaseTweens *tweens, EaseTweenHandle handle)
+{
+    if ((handle.slot < 0) || (handle.slot >= tweens->blockCount*EASINGS_TWEEN_BLOCK_SIZE)) return 0;
+
+    const EaseTweenSlot *s = EaseTweenGetSlot(tweens, handle.slot);
+
+    return ((handle.generation != 0) && (s->generation == handle.generation) && (s->type >= 0));
+}
+
+// Removes the tween at index of a bucket, moving the last tween of the bucket into its place
+// NOTE: The bucket stays dense, the moved tween's slot is pointed at its new index
+static inline void EaseTweenRemoveAt(EaseTweens *tweens, int type, int index)
+{
+    EaseTweenBucket *bucket = &tweens->buckets[type];
+    int last = --bucket->count;
+    int slot = bucket->slot[index];
+
+    if (index != last)
+    {
+        bucket->start[index] = bucket->start[last];
+        bucket->d[index] = bucket->d[last];
+        bucket->invD[index] = bucket->invD[last];
+        bucket->b[index] = bucket->b[last];
+        bucket->c[index] = bucket->c[last];
+        bucket->target[index] = bucket->target[last];
+        bucket->slot[index] = bucket->slot[last];
+
+        EaseTweenGetSlot(tweens, bucket->slot[index])->index = index;
+    }
+
+    EaseTweenSlot *s = EaseTweenGetSlot(tweens, slot);
+    s->generation++;
+    s->type = -1;
+    s->index = tweens->freeSlot;
+    tweens->freeSlot = slot;
+}
+
+// Removes the tween of a handle, returns 0 on success or -1 if the handle is stale
+static inline int EaseTweenRemove(EaseTweens *tweens, EaseTweenHandle handle)
+{
+    if (!EaseTweenIsAlive(tweens, handle)) return -1;
+
+    const EaseTweenSlot *s = EaseTweenGetSlot(tweens, handle.slot);
+    EaseTweenRemoveAt(tweens, s->type, s->index);
+
+    return 0;
+}
+
+static inline int EaseTweensCount(const EaseTweens *tweens)
+{
+    int count = 0;
+
+    for (int i = 0; i < EASE_TYPE_COUNT; i++) count += tweens->buckets[i].count;
+
+    return count;
+}
+
+// Writes the value of every tween at the given time
+static inline void EaseTweensUpdate(const EaseTweens *tweens, float time)
+{
+    for (int i = 0; i < EASE_TYPE_COUNT; i++)
+    {
+        const EaseTweenBucket *bucket = &tweens->buckets[i];
+
+        if (bucket->count > 0) easeTweenUpdateFuncs[i](bucket, time, 0, bucket->count);
+    }
+}
+
+// Removes the tweens that ended before or at the given time, returns how many were removed
+// NOTE: Their targets keep the last value written, call EaseTweensUpdate() first to get b + c
+static inline int EaseTweensRemoveFinished(EaseTweens *tweens, float time)
+{
+    int removed = 0;
+
+    for (int i = 0; i < EASE_TYPE_COUNT; i++)
+    {
+        EaseTweenBucket *bucket = &tweens->buckets[i];
+
+        for (int j = 0; j < bucket->count; )
+        {
+            if ((time - bucket->start[j]) >= bucket->d[j])
+            {
+                EaseTweenRemoveAt(tweens, i, j);
+                removed++;
+            }
+            else j++;
+        }
+    }
+
+    return removed;
+}
+
+// Keyframe tracks
+// NOTE: A track is a list of keys in increasing time order, each key easing from its value to
+// the next key's value with its own easing type. Lookups start from a cursor kept in the track:
+// while time moves forward it stays in the cursor segment or moves to the next one (amortized
+// O(1)), any other jump is a binary search over the key times. The value between two keys is
+// the Penner function of the key type with t = time - time0, b = value0, c = value1 - value0 and
+// d = time1 - time0, before the first key it is the first value and after the last the last value.
+#define EASINGS_HAS_TRACKS
+
+#define EASINGS_TRACK_MIN_CAPACITY      16
+
+typedef struct EaseTrack {
+    int count;
+    int capacity;
+    int cursor;         // Segment of the last lookup
+    float *time;        // Key times, increasing
+    float *value;       // Key values
+    EaseType *type;     // Easing from each key to the next
+} EaseTrack;
+
+static inline void EaseTrackInit(EaseTrack *track)
+{
+    memset(track, 0, sizeof(*track));
+}
+
+static inline void EaseTrackFree(EaseTrack *track)
+{
+    free(track->time);
+    free(track->value);
+    free(track->type);
+
+    EaseTrackInit(track);
+}
+
+// Appends a key, returns 0 on success or -1 if time is not after the last key or it can't be stored
+static inline int EaseTrackAddKey(EaseTrack *track, float time, float value, EaseType type)
+{
+    if ((track->count > 0) && !(time > track->time[track->count - 1])) return -1;
+
+    if (track->count == track->capacity)
+    {
+        int size = (track->capacity < EASINGS_TRACK_MIN_CAPACITY)? EASINGS_TRACK_MIN_CAPACITY : 2*track->capacity;
+
+        float *times = (float *)realloc(track->time, size*sizeof(float));
+        if (times == NULL) return -1;
+        track->time = times;
+
+        float *values = (float *)realloc(track->value, size*sizeof(float));
+        if (values == NULL) return -1;
+        track->value = values;
+
+        EaseType *types = (EaseType *)realloc(track->type, size*sizeof(EaseType));
+        if (types == NULL) return -1;
+        track->type = types;
+
+        track->capacity = size;
+    }
+
+    track->time[track->count] = time;
+    track->value[track->count] = value;
+    track->type[track->count] = type;
+    track->count++;
+
+    return 0;
+}
+
+// Finds the segment [time[i], time[i + 1]) holding time by binary search, without the cursor
+// NOTE: Returns 0 before the second key and count - 2 from the last one on, the track needs 2 keys
+static inline int EaseTrackSearch(const EaseTrack *track, float time)
+{
+    int lo = 0;
+    int hi = track->count - 2;
+
+    while (lo < hi)
+    {
+        int mid = (lo + hi + 1)/2;
+
+        if (track->time[mid] <= time) lo = mid;
+        else hi = mid - 1;
+    }
+
+    return lo;
+}
+
+// Finds the segment holding time starting from the cursor, and moves the cursor to it
+static inline int EaseTrackFind(EaseTrack *track, float time)
+{
+    int i = track->cursor;
+    int last = track->count - 2;
+
+    if ((i > last) || (time < track->time[i])) i = EaseTrackSearch(track, time);
+    else if ((i < last) && (time >= track->time[i + 1]))
+    {
+        // NOTE: Frame steps shorter than a key cross at most one key, longer jumps search
+        if ((i + 1 == last) || (time < track->time[i + 2])) i++;
+        else i = EaseTrackSearch(track, time);
+    }
+
+    track->cursor = i;
+
+    return i;
+}
+
+// Eases the value of a segment of the track at time
+static inline float EaseTrackSegmentValue(const EaseTrack *track, int i, float time)
+{
+    float t0 = track->time[i];
+    float t1 = track->time[i + 1];
+
+    if (time <= t0) return track->value[i];
+    if (time >= t1) return track->value[i + 1];
+
+    float b = track->value[i];
+
+    return ((track->value[i + 1] - b)*EaseCurveU(track->type[i], (time - t0)/(t1 - t0)) + b);
+}
+
+// Returns the value of the track at time, moving its cursor (0.0f for an empty track)
+static inline float EaseTrackEval(EaseTrack *track, float time)
+{
+    if (track->count < 2) return (track->count == 1)? track->value[0] : 0.0f;
+
+    return EaseTrackSegmentValue(track, EaseTrackFind(track, time), time);
+}
+
+// Same as EaseTrackEval() with a binary search for every lookup, the track is left untouched
+static inline float EaseTrackSeek(const EaseTrack *track, float time)
+{
+    if (track->count < 2) return (track->count == 1)? track->value[0] : 0.0f;
+
+    return EaseTrackSegmentValue(track, EaseTrackSearch(track, time), time);
+}
+
+#if defined(EASINGS_TWEEN_THREADS)
+// Parallel update
+// NOTE: Buckets are cut into tasks of about EASINGS_TWEEN_TASK_SIZE tweens and the task list is split
+// in even slices, one per thread. Each thread runs its own slice from the end and, once empty,
+// steals from the start of the others, so a slice full of Elastic tweens gets shared out.
+// A task only ends where the next tween's target is in another cache line, so when each bucket's
+// targets are laid out in bucket order, starting on a line (EASINGS_TWEEN_LINE_SIZE aligned),
+// no two tasks write to the same line. Targets in any other order (removals move tweens around)
+// are still updated right, but threads may then write to the same lines (false sharing).
+// Requires pthreads and GCC/Clang __atomic builtins.
+#include <pthread.h>
+
+#define EASINGS_TWEEN_MAX_THREADS       64
+#define EASINGS_TWEEN_TASK_SIZE         2048
+
+typedef struct EaseTweenTask {
+    int type;
+    int begin;
+    int end;
+} EaseTweenTask;
+
+// Slice of the task list still to run, as head | (tail << 32), alone in its cache line
+typedef struct EaseTweenQueue {
+    uint64_t range;
+    char padding[64 - sizeof(uint64_t)];
+} EaseTweenQueue;
+
+typedef struct EaseTweenPool EaseTweenPool;
+
+typedef struct EaseTweenWorker {
+    EaseTweenPool *pool;
+    int index;
+} EaseTweenWorker;
+
+struct EaseTweenPool {
+    EaseTweenQueue queues[EASINGS_TWEEN_MAX_THREADS];
+    int threads;                // Threads running tasks, including the caller of the update
+    pthread_t handles[EASINGS_TWEEN_MAX_THREADS];
+    EaseTweenWorker workers[EASINGS_TWEEN_MAX_THREADS];
+    pthread_mutex_t lock;
+    pthread_cond_t start;       // Signaled when a frame starts (or on quit)
+    pthread_cond_t done;        // Signaled when the last worker finishes its frame
+    unsigned int frame;
+    int running;                // Workers still busy with the current frame
+    int quit;
+    const EaseTweens *tweens;
+    float time;
+    EaseTweenTask *tasks;
+    int taskCapacity;
+};
+
+// Takes the last task of a queue (owner side), returns 0 if it is empty
+static inline int EaseTweenQueuePop(EaseTweenQueue *queue, int *task)
+{
+    uint64_t range = __atomic_load_n(&queue->range, __ATOMIC_ACQUIRE);
+
+    for (;;)
+    {
+        uint32_t head = (uint32_t)range;
+        uint32_t tail = (uint32_t)(range >> 32);
+
+        if (head >= tail) return 0;
+
+        uint64_t next = head | ((uint64_t)(tail - 1) << 32);
+
+        if (__atomic_compare_exchange_n(&queue->range, &range, next, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        {
+            *task = (int)(tail - 1);
+            return 1;
+        }
+    }
+}
+
+// Takes the first task of a queue (thief side), returns 0 if it is empty
+static inline int EaseTweenQueueSteal(EaseTweenQueue *queue, int *task)
+{
+    uint64_t range = __atomic_load_n(&queue->range, __ATOMIC_ACQUIRE);
+
+    for (;;)
+    {
+        uint32_t head = (uint32_t)range;
+        uint32_t tail = (uint32_t)(range >> 32);
+
+        if (head >= tail) return 0;
+
+        uint64_t next = (head + 1) | ((uint64_t)tail << 32);
+
+        if (__atomic_compare_exchange_n(&queue->range, &range, next, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        {
+            *task = (int)head;
+            return 1;
+        }
+    }
+}
+
+// Runs tasks until every queue is empty, no task is added during a frame
+static inline void EaseTweenPoolWork(EaseTweenPool *pool, int self)
+{
+    int task;
+
+    for (;;)
+    {
+        int found = EaseTweenQueuePop(&pool->queues[self], &task);
+
+        for (int k = 1; !found && (k < pool->threads); k++)
+        {
+            found = EaseTweenQueueSteal(&pool->queues[(self + k)%pool->threads], &task);
+        }
+
+        if (!found) break;
+
+        const EaseTweenTask *t = &pool->tasks[task];
+        easeTweenUpdateFuncs[t->type](&pool->tweens->buckets[t->type], pool->time, t->begin, t->end);
+    }
+}
+
+static void *EaseTweenPoolThread(void *arg)
+{
+    EaseTweenWorker *worker = (EaseTweenWorker *)arg;
+    EaseTweenPool *pool = worker->pool;
+    unsigned int seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+
+    for (;;)
+    {
+        while ((pool->frame == seen) && !pool->quit) pthread_cond_wait(&pool->start, &pool->lock);
+
+        if (pool->quit) break;
+
+        seen = pool->frame;
+        pthread_mutex_unlock(&pool->lock);
+
+        EaseTweenPoolWork(pool, worker->index);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->running == 0) pthread_cond_signal(&pool->done);
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+// Starts threads - 1 worker threads (the caller of the update is the last one), returns 0 on success
+static inline int EaseTweenPoolInit(EaseTweenPool *pool, int threads)
+{
+    memset(pool, 0, sizeof(*pool));
+
+    if (threads < 1) threads = 1;
+    if (threads > EASINGS_TWEEN_MAX_THREADS) threads = EASINGS_TWEEN_MAX_THREADS;
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    pool->threads = 1;
+
+    for (int i = 1; i < threads; i++)
+    {
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i;
+
+        if (pthread_create(&pool->handles[i], NULL, EaseTweenPoolThread, &pool->workers[i]) != 0) break;
+
+        pool->threads++;
+    }
+
+    return (pool->threads == threads)? 0 : -1;
+}
+
+static inline void EaseTweenPoolFree(EaseTweenPool *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 1; i < pool->threads; i++) pthread_join(pool->handles[i], NULL);
+
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->start);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->tasks);
+
+    memset(pool, 0, sizeof(*pool));
+}
+
+// Same as EaseTweensUpdate() using all the threads of the pool, returns 0 on success
+// NOTE: Only fails if the task list can't grow, the tweens are then updated on the calling thread
+static inline int EaseTweensUpdateParallel(const EaseTweens *tweens, EaseTweenPool *pool, float time)
+{
+    int count = 0;
+
+    for (int i = 0; i < EASE_TYPE_COUNT; i++)
+    {
+        count += (tweens->buckets[i].count + EASINGS_TWEEN_TASK_SIZE - 1)/EASINGS_TWEEN_TASK_SIZE;
+    }
+
+    if (count > pool->taskCapacity)
+    {
+        EaseTweenTask *tasks = (EaseTweenTask *)realloc(pool->tasks, count*sizeof(EaseTweenTask));
+
+        if (tasks == NULL)
+        {
+            EaseTweensUpdate(tweens, time);
+            return -1;
+        }
+
+        pool->tasks = tasks;
+        pool->taskCapacity = count;
+    }
+
+    count = 0;
+
+    for (int i = 0; i < EASE_TYPE_COUNT; i++)
+    {
+        const EaseTweenBucket *bucket = &tweens->buckets[i];
+
+        for (int begin = 0, end; begin < bucket->count; begin = end)
+        {
+            end = begin + EASINGS_TWEEN_TASK_SIZE;
+            if (end > bucket->count) end = bucket->count;
+
+            // NOTE: Moving the end forward only makes fewer tasks than counted above
+            while ((end < bucket->count) &&
+                   ((uintptr_t)bucket->target[end - 1]/EASINGS_TWEEN_LINE_SIZE == (uintptr_t)bucket->target[end]/EASINGS_TWEEN_LINE_SIZE)) end++;
+
+            pool->tasks[count].type = i;
+            pool->tasks[count].begin = begin;
+            pool->tasks[count].end = end;
+            count++;
+        }
+    }
+
+    for (int i = 0; i < pool->threads; i++)
+    {
+        uint64_t head = (uint64_t)count*i/pool->threads;
+        uint64_t tail = (uint64_t)count*(i + 1)/pool->threads;
+
+        __atomic_store_n(&pool->queues[i].range, head | (tail << 32), __ATOMIC_RELEASE);
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->tweens = tweens;
+    pool->time = time;
+    pool->running = pool->threads - 1;
+    pool->frame++;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    EaseTweenPoolWork(pool, 0);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->running > 0) pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+
+    return 0;
+}
+#endif // EASINGS_TWEEN_THREADS
+
+#endif // EASINGS_TWEEN_H
@@ -6,12 +6,19 @@ T1OUT="result_orig.txt"  #Output file for the results of the test using the orig
 T2OUT="result_newh.txt"  #Output file for the results of the test using the modified header
 DIFFF="diff_out.txt"  #Output file for the diff operation
 NDPARAMS=""  #Test program numerical options
+ORIGDEFS=""  #Compile-time switches for the original header build
+MODFDEFS=""  #Compile-time switches for the modified header build (e.g. "-DEASINGS_FAST_EXP2")
 
 cp -v $ORIGHDR easings.h
-make
+make DEFINES="$ORIGDEFS"
 ./easings_results --out=$T1OUT $NDPARAMS
 
 cp -v $MODFHDR easings.h
-make
+make DEFINES="$MODFDEFS"
 ./easings_results --out=$T2OUT $NDPARAMS
 diff -s -y -t $T1OUT $T2OUT > $DIFFF
+
+#Largest difference between both outputs, results within float rounding count as a match
+paste $T1OUT $T2OUT | awk -F'[ \t:]+' '$3 + 0 == $3 && $5 + 0 == $5 {
+	x = $3 - $5; if (x < 0) x = -x; if (x > max) { max = x; line = NR }
+} END { printf "Largest difference: %f (line %d)\n", max, line }'
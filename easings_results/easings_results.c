@@ -27,11 +27,16 @@
 
 
 #include "easings.h"
+#if defined(EASINGS_HAS_BATCH)
+	#include "../easings_perftest/easings_simd.h"  // NOTE: Needs the batch API, missing in older easings.h
+#endif
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <errno.h>
 #include <float.h>
+#include <math.h>
+#include <stdint.h>
 
 
 enum easing_types {
@@ -63,9 +68,17 @@ enum easing_types {
 	EASE_ELASTIC_IN,
 	EASE_ELASTIC_OUT,
 	EASE_ELASTIC_IN_OUT,
+#if defined(EASINGS_HAS_BEZIER)
+	EASE_CSS_EASE,
+	EASE_CSS_EASE_IN,
+	EASE_CSS_EASE_OUT,
+	EASE_CSS_EASE_IN_OUT,
+#endif
 	NUM_EASING_TYPES,
 };
 
+#define NUM_PENNER_TYPES (EASE_ELASTIC_IN_OUT + 1)  // NOTE: Same order as EaseType
+
 static const struct {
 	const char *name;
 	float (*func)(float, float, float, float);
@@ -182,9 +195,48 @@ static const struct {
 		.name = "EaseElasticInOut",
 		.func = EaseElasticInOut,
 	},
+#if defined(EASINGS_HAS_BEZIER)
+	[EASE_CSS_EASE] = {
+		.name = "EaseCssEase",
+		.func = EaseCssEase,
+	},
+	[EASE_CSS_EASE_IN] = {
+		.name = "EaseCssEaseIn",
+		.func = EaseCssEaseIn,
+	},
+	[EASE_CSS_EASE_OUT] = {
+		.name = "EaseCssEaseOut",
+		.func = EaseCssEaseOut,
+	},
+	[EASE_CSS_EASE_IN_OUT] = {
+		.name = "EaseCssEaseInOut",
+		.func = EaseCssEaseInOut,
+	},
+#endif
 };
 
 
+#if defined(EASINGS_FAST_SINCOS_ULP)
+static int check_fast_math(FILE *fp);
+#endif
+#if defined(EASINGS_HAS_TABLE)
+static void check_tables(FILE *fp);
+#endif
+#if defined(EASINGS_HAS_STEPPER)
+static void check_steppers(FILE *fp, float b, float c, float d, float td);
+#endif
+#if defined(EASINGS_HAS_BEZIER)
+static void check_beziers(FILE *fp);
+#endif
+#if defined(EASINGS_HAS_DERIVATIVES)
+static int check_derivatives(FILE *fp);
+#endif
+#if defined(EASINGS_HAS_PARAMS)
+static void check_params(FILE *fp);
+#endif
+#if defined(EASINGS_HAS_SIMD)
+static int check_simd(FILE *fp, float b, float c, float d);
+#endif
 static int get_float_arg(char *argvi, char *arg_prefix, float min, float max,
                          float *arg_var);
 static int get_string_arg(char *argvi, char *arg_prefix, char *arg_array,
@@ -200,13 +252,26 @@ static int get_string_arg(char *argvi, char *arg_prefix, char *arg_array,
 	"      --d=<val>: Makes <val> the total time the interpolation takes\n"\
 	"      --td=<val>: Makes <val> the time unit advanced in each iteration\n"\
 	"      --out=<file>: Writes the results to a stream specified by <file>\n"\
+	"      --ulp: Checks the error of the easings.h fast math functions\n"\
+	"      --lut: Prints the worst-case error of the easings.h tables\n"\
+	"      --stepper: Prints the worst-case error of the easings.h steppers\n"\
+	"        over [0, d] at the given td\n"\
+	"      --bezier: Prints the worst-case error of the easings.h bezier\n"\
+	"        easings against a double precision solver\n"\
+	"      --deriv: Checks the easings.h derivatives against numerical ones\n"\
+	"      --params: Prints the worst-case error of the easings.h parameterized\n"\
+	"        Back and Elastic easings, and their difference from the fixed ones\n"\
+	"      --simd: Checks the easings_simd.h kernels of every level the CPU\n"\
+	"        supports against the easings.h batch functions over [0, d]\n"\
 	"    <val> must be a floating-point value inside a range defined by the\n"\
 	"    program for each option. <file> must be a valid path to a file or\n"\
 	"    stream.\n"\
 	"  If no values or invalid values are provided, the program will use a\n"\
 	"  predefined default for each option. If no <file> is provided, the\n"\
 	"  program will output to stdout. If any option is provided more than\n"\
-	"  once, only the first occurence will be taken into account.\n"
+	"  once, only the first occurence will be taken into account. With --ulp,\n"\
+	"  --deriv and --simd, the program exits with failure if any error is\n"\
+	"  above its bound.\n"
 
 #define MAX_LIMIT_DIV 10000.0f
 #define MIN_B 0.0f
@@ -239,8 +304,16 @@ int main(int argc, char *argv[])
 		unsigned char d: 1;
 		unsigned char td: 1;
 		unsigned char out: 1;
+		unsigned char ulp: 1;
+		unsigned char lut: 1;
+		unsigned char stepper: 1;
+		unsigned char bezier: 1;
+		unsigned char deriv: 1;
+		unsigned char params: 1;
+		unsigned char simd: 1;
 	} args_set = {
-		.b = 0, .c = 0, .d = 0, .td = 0, .out = 0,
+		.b = 0, .c = 0, .d = 0, .td = 0, .out = 0, .ulp = 0, .lut = 0,
+		.stepper = 0, .bezier = 0, .deriv = 0, .params = 0, .simd = 0,
 	};
 
 	float arg_b;
@@ -283,8 +356,38 @@ int main(int argc, char *argv[])
 			}
 		}
 		else
+		if (strcmp(argv[i], "--ulp") == 0) {
+			args_set.ulp = 1;
+		}
+		else
+		if (strcmp(argv[i], "--lut") == 0) {
+			args_set.lut = 1;
+		}
+		else
+		if (strcmp(argv[i], "--stepper") == 0) {
+			args_set.stepper = 1;
+		}
+		else
+		if (strcmp(argv[i], "--bezier") == 0) {
+			args_set.bezier = 1;
+		}
+		else
+		if (strcmp(argv[i], "--deriv") == 0) {
+			args_set.deriv = 1;
+		}
+		else
+		if (strcmp(argv[i], "--params") == 0) {
+			args_set.params = 1;
+		}
+		else
+		if (strcmp(argv[i], "--simd") == 0) {
+			args_set.simd = 1;
+		}
+		else
 		if (args_set.b == 1 && args_set.c == 1 && args_set.d == 1 &&
-		    args_set.td == 1 && args_set.out == 1)
+		    args_set.td == 1 && args_set.out == 1 && args_set.ulp == 1 &&
+		    args_set.lut == 1 && args_set.stepper == 1 && args_set.bezier == 1 &&
+		    args_set.deriv == 1 && args_set.params == 1 && args_set.simd == 1)
 		{
 			break;
 		}
@@ -314,6 +417,104 @@ int main(int argc, char *argv[])
 		fprintf(stderr, "Using file %s\n", arg_out);
 	}
 
+	if (args_set.ulp == 1) {
+#if defined(EASINGS_FAST_SINCOS_ULP)
+		int status = check_fast_math(fp);
+
+		if (args_set.out == 1) {
+			fclose(fp);
+		}
+
+		return status;
+#else
+		fprintf(stderr, "easings.h has no fast math functions, ignoring --ulp\n");
+#endif
+	}
+
+	if (args_set.lut == 1) {
+#if defined(EASINGS_HAS_TABLE)
+		check_tables(fp);
+
+		if (args_set.out == 1) {
+			fclose(fp);
+		}
+
+		return EXIT_SUCCESS;
+#else
+		fprintf(stderr, "easings.h has no easing tables, ignoring --lut\n");
+#endif
+	}
+
+	if (args_set.stepper == 1) {
+#if defined(EASINGS_HAS_STEPPER)
+		check_steppers(fp, arg_b, arg_c, arg_d, arg_td);
+
+		if (args_set.out == 1) {
+			fclose(fp);
+		}
+
+		return EXIT_SUCCESS;
+#else
+		fprintf(stderr, "easings.h has no easing steppers, ignoring --stepper\n");
+#endif
+	}
+
+	if (args_set.bezier == 1) {
+#if defined(EASINGS_HAS_BEZIER)
+		check_beziers(fp);
+
+		if (args_set.out == 1) {
+			fclose(fp);
+		}
+
+		return EXIT_SUCCESS;
+#else
+		fprintf(stderr, "easings.h has no bezier easings, ignoring --bezier\n");
+#endif
+	}
+
+	if (args_set.deriv == 1) {
+#if defined(EASINGS_HAS_DERIVATIVES)
+		int status = check_derivatives(fp);
+
+		if (args_set.out == 1) {
+			fclose(fp);
+		}
+
+		return status;
+#else
+		fprintf(stderr, "easings.h has no derivatives, ignoring --deriv\n");
+#endif
+	}
+
+	if (args_set.params == 1) {
+#if defined(EASINGS_HAS_PARAMS)
+		check_params(fp);
+
+		if (args_set.out == 1) {
+			fclose(fp);
+		}
+
+		return EXIT_SUCCESS;
+#else
+		fprintf(stderr, "easings.h has no parameterized easings, ignoring --params\n");
+#endif
+	}
+
+	if (args_set.simd == 1) {
+#if defined(EASINGS_HAS_SIMD)
+		int status = check_simd(fp, arg_b, arg_c, arg_d);
+
+		if (args_set.out == 1) {
+			fclose(fp);
+		}
+
+		return status;
+#else
+		fprintf(stderr, "easings.h has no batch functions, ignoring --simd\n");
+#endif
+	}
+
 	long iterations = (arg_d / arg_td) + 1.0f;
 
 	fprintf(stderr, "Doing %ld iterations\n", iterations);
@@ -341,6 +542,594 @@ int main(int argc, char *argv[])
 	return EXIT_SUCCESS;
 }
 
+#if defined(EASINGS_FAST_SINCOS_ULP)
+#define ULP_SAMPLES 4000000L
+
+static const struct {
+	const char *name;
+	float (*func)(float);
+	double (*ref)(double);
+	float min;
+	float max;
+	float bound;
+} fast_math[] = {
+	{ "EaseFastSinf", EaseFastSinf, sin, 0.0f, PI/2.0f, EASINGS_FAST_SINCOS_ULP },
+	{ "EaseFastSinf", EaseFastSinf, sin, -PI, PI, EASINGS_FAST_SINCOS_ULP },
+	{ "EaseFastSinf", EaseFastSinf, sin, -64.0f*PI, 64.0f*PI, EASINGS_FAST_SINCOS_ULP_WIDE },
+	{ "EaseFastCosf", EaseFastCosf, cos, 0.0f, PI/2.0f, EASINGS_FAST_SINCOS_ULP },
+	{ "EaseFastCosf", EaseFastCosf, cos, -PI, PI, EASINGS_FAST_SINCOS_ULP },
+	{ "EaseFastCosf", EaseFastCosf, cos, -64.0f*PI, 64.0f*PI, EASINGS_FAST_SINCOS_ULP_WIDE },
+	{ "EaseFastExp2f", EaseFastExp2f, exp2, -10.0f, 0.0f, EASINGS_FAST_EXP2_ULP },
+	{ "EaseFastExp2f", EaseFastExp2f, exp2, -126.0f, 127.0f, EASINGS_FAST_EXP2_ULP },
+};
+
+// Maps floats to integers keeping their order, so ranges can be walked by representation
+static int32_t float_to_key(float x)
+{
+	int32_t bits;
+	memcpy(&bits, &x, sizeof(bits));
+
+	return (bits < 0)? -(bits & INT32_MAX) : bits;
+}
+
+static float key_to_float(int32_t key)
+{
+	int32_t bits = (key < 0)? ((-key) | INT32_MIN) : key;
+	float x;
+	memcpy(&x, &bits, sizeof(x));
+
+	return x;
+}
+
+// Error of approx in units of the last place of the float nearest to exact
+static double ulp_error(float approx, double exact)
+{
+	int exp;
+	float nearest = (float) exact;
+
+	if (fabsf(nearest) < FLT_MIN) {
+		return fabs(approx - exact) / ldexp(1.0, FLT_MIN_EXP - FLT_MANT_DIG);
+	}
+
+	frexpf(nearest, &exp);
+
+	return fabs(approx - exact) / ldexp(1.0, exp - FLT_MANT_DIG);
+}
+
+static int check_fast_math(FILE *fp)
+{
+	int status = EXIT_SUCCESS;
+
+	fprintf(fp, "Fast math maximum errors (%ld samples per range):\n",
+	            ULP_SAMPLES);
+
+	for (size_t i = 0; i < sizeof(fast_math) / sizeof(fast_math[0]); ++i) {
+		int32_t first = float_to_key(fast_math[i].min);
+		int32_t last = float_to_key(fast_math[i].max);
+		int64_t step = ((int64_t) last - first) / (ULP_SAMPLES / 2) + 1;
+		double range = (double) fast_math[i].max - fast_math[i].min;
+		double max_err = 0.0;
+		float max_x = fast_math[i].min;
+
+		// Half the samples are evenly spaced by value, half by representation
+		// (dense around zero, where the relative error matters most)
+		for (long j = 0; j < ULP_SAMPLES; ++j) {
+			float x;
+
+			if (j < ULP_SAMPLES / 2) {
+				x = fast_math[i].min + range * j / (ULP_SAMPLES / 2 - 1);
+			}
+			else {
+				int64_t key = first + step * (j - ULP_SAMPLES / 2);
+				x = key_to_float((key < last)? (int32_t) key : last);
+			}
+
+			double err = ulp_error(fast_math[i].func(x), fast_math[i].ref(x));
+
+			if (err > max_err) {
+				max_err = err;
+				max_x = x;
+			}
+		}
+
+		int ok = max_err <= fast_math[i].bound;
+
+		fprintf(fp, "%-14s [%12.6f, %12.6f]: %6.3f ulp at x = %.9g (bound %.1f) %s\n",
+		            fast_math[i].name, fast_math[i].min, fast_math[i].max,
+		            max_err, max_x, fast_math[i].bound, ok? "OK" : "FAILED");
+
+		if (!ok) {
+			status = EXIT_FAILURE;
+		}
+	}
+
+	return status;
+}
+#endif
+
+#if defined(EASINGS_HAS_TABLE)
+#define LUT_SAMPLES 200000L
+
+static void check_tables(FILE *fp)
+{
+	static const EaseTableInterp interps[] = {
+		EASE_TABLE_LINEAR, EASE_TABLE_CATMULL_ROM,
+	};
+
+	fprintf(fp, "Table maximum errors for c = 1 (%ld samples per curve):\n",
+	            LUT_SAMPLES);
+	fprintf(fp, "%-18s %-12s", "", "interp");
+
+	for (int size = EASINGS_TABLE_MIN_SIZE; size <= EASINGS_TABLE_MAX_SIZE;
+	     size *= 4)
+	{
+		fprintf(fp, " %10d", size);
+	}
+
+	fprintf(fp, "\n");
+
+	for (enum easing_types i = 0; i < NUM_PENNER_TYPES; ++i) {
+		for (size_t k = 0; k < sizeof(interps) / sizeof(interps[0]); ++k) {
+			fprintf(fp, "%-18s %-12s", easings[i].name,
+			            (interps[k] == EASE_TABLE_LINEAR)? "linear" : "catmull-rom");
+
+			for (int size = EASINGS_TABLE_MIN_SIZE;
+			     size <= EASINGS_TABLE_MAX_SIZE; size *= 4)
+			{
+				double max_err = 0.0;
+
+				EaseTableSetSize(size);
+
+				for (long j = 0; j < LUT_SAMPLES; ++j) {
+					float u = (float) j / (LUT_SAMPLES - 1);
+					double err = fabs((double) EaseTableU((EaseType) i, u, interps[k]) -
+					                  EaseCurveU((EaseType) i, u));
+
+					if (err > max_err) {
+						max_err = err;
+					}
+				}
+
+				fprintf(fp, " %10.3e", max_err);
+			}
+
+			fprintf(fp, "\n");
+		}
+	}
+
+	EaseTableFree();
+}
+#endif
+
+#if defined(EASINGS_HAS_STEPPER)
+static void check_steppers(FILE *fp, float b, float c, float d, float td)
+{
+	static const char *kind_names[] = {
+		[EASE_STEPPER_EXACT] = "exact",
+		[EASE_STEPPER_POLY] = "differences",
+		[EASE_STEPPER_WAVE] = "recurrence",
+	};
+
+	long iterations = (d / td) + 1.0f;
+
+	fprintf(fp, "Stepper maximum errors over %ld steps (resync every %d):\n",
+	            iterations, EASINGS_STEPPER_RESYNC);
+	fprintf(fp, "%-18s %-12s %12s %12s\n", "", "kind", "abs error",
+	            "error / c");
+
+	for (enum easing_types i = 0; i < NUM_PENNER_TYPES; ++i) {
+		EaseStepper stepper = EaseStepperStart((EaseType) i, 0.0f, td, b, c, d);
+		double max_err = 0.0;
+
+		for (long j = 0; j < iterations; ++j) {
+			float t = EaseStepperTime(&stepper, (int) j);
+			double err = fabs((double) EaseStepperNext(&stepper) -
+			                  easings[i].func(t, b, c, d));
+
+			if (err > max_err) {
+				max_err = err;
+			}
+		}
+
+		fprintf(fp, "%-18s %-12s %12.3e %12.3e\n", easings[i].name,
+		            kind_names[stepper.kind], max_err, max_err / fabs(c));
+	}
+}
+#endif
+
+#if defined(EASINGS_HAS_BEZIER)
+#define BEZIER_SAMPLES 200000L
+
+// Cubic bezier coordinate at s, for control point values p1 and p2
+static double bezier_coord(double p1, double p2, double s)
+{
+	double r = 1.0 - s;
+
+	return 3.0 * r * r * s * p1 + 3.0 * r * s * s * p2 + s * s * s;
+}
+
+static void check_beziers(FILE *fp)
+{
+	static const struct {
+		const char *name;
+		float x1, y1, x2, y2;
+	} curves[] = {
+		{ "ease", 0.25f, 0.1f, 0.25f, 1.0f },
+		{ "ease-in", 0.42f, 0.0f, 1.0f, 1.0f },
+		{ "ease-out", 0.0f, 0.0f, 0.58f, 1.0f },
+		{ "ease-in-out", 0.42f, 0.0f, 0.58f, 1.0f },
+		{ "linear", 0.0f, 0.0f, 1.0f, 1.0f },
+		{ "back", 0.68f, -0.55f, 0.265f, 1.55f },
+		{ "steep middle", 1.0f, 0.0f, 0.0f, 1.0f },
+		{ "steep ends", 0.0f, 1.0f, 1.0f, 0.0f },
+	};
+
+	fprintf(fp, "Bezier maximum errors for c = 1 (%ld samples per curve):\n",
+	            BEZIER_SAMPLES);
+	fprintf(fp, "%-12s %-28s %12s %12s\n", "", "cubic-bezier", "error", "at u");
+
+	for (size_t i = 0; i < sizeof(curves) / sizeof(curves[0]); ++i) {
+		EaseBezier bezier = EaseBezierCreate(curves[i].x1, curves[i].y1,
+		                                     curves[i].x2, curves[i].y2);
+		double max_err = 0.0;
+		float max_u = 0.0f;
+
+		for (long j = 0; j < BEZIER_SAMPLES; ++j) {
+			float u = (float) j / (BEZIER_SAMPLES - 1);
+			double lo = 0.0;
+			double hi = 1.0;
+
+			// NOTE: x grows with s, so bisection always finds the s of u
+			for (int k = 0; k < 60; ++k) {
+				double s = 0.5 * (lo + hi);
+
+				if (bezier_coord(curves[i].x1, curves[i].x2, s) > u) {
+					hi = s;
+				}
+				else {
+					lo = s;
+				}
+			}
+
+			double exact = bezier_coord(curves[i].y1, curves[i].y2,
+			                            0.5 * (lo + hi));
+			double err = fabs((double) EaseBezierU(&bezier, u) - exact);
+
+			if (err > max_err) {
+				max_err = err;
+				max_u = u;
+			}
+		}
+
+		char spec[64];
+
+		snprintf(spec, sizeof(spec), "(%.3g, %.3g, %.3g, %.3g)", curves[i].x1,
+		         curves[i].y1, curves[i].x2, curves[i].y2);
+		fprintf(fp, "%-12s %-28s %12.3e %12.6f\n", curves[i].name, spec,
+		            max_err, max_u);
+	}
+}
+#endif
+
+#if defined(EASINGS_HAS_PARAMS)
+#define PARAMS_SAMPLES 100000L
+#define PARAMS_PI 3.14159265358979323846  // NOTE: M_PI is not in C99
+
+static const struct {
+	const char *name;
+	float (*fixed)(float);
+	int elastic;
+} params_curves[] = {
+	{ "EaseBackInEx", EaseBackInU, 0 },
+	{ "EaseBackOutEx", EaseBackOutU, 0 },
+	{ "EaseBackInOutEx", EaseBackInOutU, 0 },
+	{ "EaseElasticInEx", EaseElasticInU, 1 },
+	{ "EaseElasticOutEx", EaseElasticOutU, 1 },
+	{ "EaseElasticInOutEx", EaseElasticInOutU, 1 },
+};
+
+// Penner's Back (overshoot k) and Elastic (amplitude k times c, period p) curves
+// in double precision, curve being an index into params_curves
+static double params_exact(int curve, double k, double p, double u)
+{
+	if (params_curves[curve].elastic) {
+		if (u == 0.0) return 0.0;
+		if (u == 1.0) return 1.0;
+
+		double a = (k > 1.0)? k : 1.0;
+		double v = (curve == 5)? 2.0 * u - 1.0 : u - (curve == 3);
+
+		if (curve == 5) p *= 1.5;
+
+		double s = p / (2.0 * PARAMS_PI) * asin(1.0 / a);
+		double wave = a * sin((v - s) * (2.0 * PARAMS_PI) / p);
+
+		if (curve == 3 || (curve == 5 && v < 0.0)) {
+			wave *= -exp2(10.0 * v);
+			return (curve == 5)? 0.5 * wave : wave;
+		}
+
+		wave *= exp2(-10.0 * v);
+		return (curve == 5)? 0.5 * wave + 1.0 : wave + 1.0;
+	}
+
+	if (curve == 0) return u * u * ((k + 1.0) * u - k);
+	if (curve == 1) return (u - 1.0) * (u - 1.0) * ((k + 1.0) * (u - 1.0) + k) + 1.0;
+
+	k *= 1.525;
+	u *= 2.0;
+	if (u < 1.0) return 0.5 * (u * u * ((k + 1.0) * u - k));
+
+	u -= 2.0;
+	return 0.5 * (u * u * ((k + 1.0) * u + k) + 2.0);
+}
+
+static float params_eval(int curve, const EaseBackParams *back,
+                         const EaseElasticParams *elastic, float u)
+{
+	switch (curve) {
+		case 0: return EaseBackInExU(back, u);
+		case 1: return EaseBackOutExU(back, u);
+		case 2: return EaseBackInOutExU(back, u);
+		case 3: return EaseElasticInExU(elastic, u);
+		case 4: return EaseElasticOutExU(elastic, u);
+		default: return EaseElasticInOutExU(elastic, u);
+	}
+}
+
+static void check_params(FILE *fp)
+{
+	// NOTE: The first set of each family has the parameters of the fixed functions
+	static const struct {
+		float k;
+		float p;
+	} back_sets[] = {
+		{ EASINGS_BACK_OVERSHOOT, 0.0f }, { 0.5f, 0.0f }, { 3.0f, 0.0f },
+	}, elastic_sets[] = {
+		{ 1.0f, EASINGS_ELASTIC_PERIOD }, { 1.5f, 0.3f }, { 2.0f, 0.6f },
+		{ 0.5f, 0.2f },
+	};
+
+	fprintf(fp, "Parameterized maximum errors for c = 1 (%ld samples per curve):\n",
+	            PARAMS_SAMPLES);
+	fprintf(fp, "%-20s %10s %10s %12s %12s %12s\n", "", "s or a", "period",
+	            "error", "at u", "vs fixed");
+
+	for (int i = 0; i < (int) (sizeof(params_curves) / sizeof(params_curves[0])); ++i) {
+		int elastic = params_curves[i].elastic;
+		int num_sets = elastic? (int) (sizeof(elastic_sets) / sizeof(elastic_sets[0]))
+		                      : (int) (sizeof(back_sets) / sizeof(back_sets[0]));
+
+		for (int j = 0; j < num_sets; ++j) {
+			float k = elastic? elastic_sets[j].k : back_sets[j].k;
+			float p = elastic? elastic_sets[j].p : back_sets[j].p;
+			EaseBackParams back = EaseBackParamsCreate(k);
+			EaseElasticParams elastic_params = EaseElasticParamsCreate(k, p);
+			double max_err = 0.0;
+			double max_fixed = 0.0;
+			float max_u = 0.0f;
+
+			for (long l = 0; l < PARAMS_SAMPLES; ++l) {
+				float u = (float) l / (PARAMS_SAMPLES - 1);
+				float value = params_eval(i, &back, &elastic_params, u);
+				double err = fabs((double) value - params_exact(i, k, p, u));
+
+				if (err > max_err) {
+					max_err = err;
+					max_u = u;
+				}
+
+				if (j == 0) {
+					err = fabs((double) value - params_curves[i].fixed(u));
+					if (err > max_fixed) max_fixed = err;
+				}
+			}
+
+			fprintf(fp, "%-20s %10g ", params_curves[i].name, k);
+
+			if (elastic) {
+				fprintf(fp, "%10g ", p);
+			}
+			else {
+				fprintf(fp, "%10s ", "-");
+			}
+
+			fprintf(fp, "%12.3e %12.6f ", max_err, max_u);
+
+			if (j == 0) {
+				fprintf(fp, "%12.3e\n", max_fixed);
+			}
+			else {
+				fprintf(fp, "%12s\n", "-");
+			}
+		}
+	}
+}
+#endif
+
+#if defined(EASINGS_HAS_DERIVATIVES)
+#define DERIV_SAMPLES 100000L
+#define DERIV_H (1.0f / 1024.0f)  // NOTE: Exact in float, so u +- k*h has no extra rounding
+#define DERIV_MAX_ERROR 1e-3
+#define DERIV_CIRC_WINDOW 0.02  // NOTE: Circ slopes grow without bound at their vertical ends
+
+// Checks if u is within window of a point where a curve jumps or bends sharply:
+// the ends, the middle of the InOut curves and the bounce segment ends
+static int near_breakpoint(float u, double window)
+{
+	static const float bounce[] = { 1.0f / 2.75f, 2.0f / 2.75f, 2.5f / 2.75f };
+	float breakpoints[3 + 4 * 3];
+	int count = 0;
+
+	breakpoints[count++] = 0.0f;
+	breakpoints[count++] = 0.5f;
+	breakpoints[count++] = 1.0f;
+
+	for (int k = 0; k < 3; ++k) {
+		breakpoints[count++] = bounce[k];
+		breakpoints[count++] = 1.0f - bounce[k];
+		breakpoints[count++] = 0.5f * (1.0f - bounce[k]);
+		breakpoints[count++] = 0.5f * (1.0f + bounce[k]);
+	}
+
+	for (int k = 0; k < count; ++k) {
+		if (fabs(u - breakpoints[k]) <= window) {
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+// Compares EaseCurveDerivU() against a fourth order central difference of
+// EaseCurveU(), and checks that EaseCurveFusedU() gives the same value and
+// derivative bits as the separate functions
+static int check_derivatives(FILE *fp)
+{
+	int status = EXIT_SUCCESS;
+
+	fprintf(fp, "Derivative maximum errors against a numerical derivative (h = %g, %ld samples per curve):\n",
+	            DERIV_H, DERIV_SAMPLES);
+	fprintf(fp, "%-18s %12s %12s %12s %10s\n", "", "abs error", "max |deriv|",
+	            "relative", "fused");
+
+	for (enum easing_types i = 0; i < NUM_PENNER_TYPES; ++i) {
+		EaseType type = (EaseType) i;
+		double max_err = 0.0;
+		double max_deriv = 0.0;
+		long fused_mismatches = 0;
+		double window = (i == EASE_CIRC_IN || i == EASE_CIRC_OUT ||
+		                 i == EASE_CIRC_IN_OUT)? DERIV_CIRC_WINDOW : 3.0 * DERIV_H;
+
+		for (long j = 0; j < DERIV_SAMPLES; ++j) {
+			float u = (float) j / (DERIV_SAMPLES - 1);
+			float deriv = EaseCurveDerivU(type, u);
+			float fused_deriv;
+			float fused = EaseCurveFusedU(type, u, &fused_deriv);
+
+			if (fused != EaseCurveU(type, u) || fused_deriv != deriv) {
+				fused_mismatches++;
+			}
+
+			if (near_breakpoint(u, window)) {
+				continue;
+			}
+
+			double numerical = (-(double) EaseCurveU(type, u + 2.0f * DERIV_H) +
+			                    8.0 * EaseCurveU(type, u + DERIV_H) -
+			                    8.0 * EaseCurveU(type, u - DERIV_H) +
+			                    EaseCurveU(type, u - 2.0f * DERIV_H)) /
+			                   (12.0 * DERIV_H);
+			double err = fabs(deriv - numerical);
+
+			if (err > max_err) {
+				max_err = err;
+			}
+
+			if (fabs(deriv) > max_deriv) {
+				max_deriv = fabs(deriv);
+			}
+		}
+
+		// NOTE: Errors are relative to the largest derivative of the curve, at least 1
+		double relative = max_err / ((max_deriv > 1.0)? max_deriv : 1.0);
+
+		fprintf(fp, "%-18s %12.3e %12.3e %12.3e %10ld\n", easings[i].name,
+		            max_err, max_deriv, relative, fused_mismatches);
+
+		if (relative > DERIV_MAX_ERROR || fused_mismatches != 0) {
+			status = EXIT_FAILURE;
+		}
+	}
+
+	return status;
+}
+#endif
+
+#if defined(EASINGS_HAS_SIMD)
+#define SIMD_SAMPLES 100003L  // NOTE: Not a multiple of any vector width, so the tail loops run too
+#define SIMD_MAX_ULP 4.0  // NOTE: Of |b| + |c|, for the kernels using the fast math polynomials
+
+// Compares the kernels of every level the CPU supports against the scalar batch
+// functions, at SIMD_SAMPLES times over [0, d]. Sine, Expo and Elastic kernels use
+// EaseFastSinf()/EaseFastExp2f(), so they must be within SIMD_MAX_ULP of the scalar
+// results, the others must give the same bits
+static int check_simd(FILE *fp, float b, float c, float d)
+{
+	static float t[SIMD_SAMPLES];
+	static float expected[SIMD_SAMPLES];
+	static float out[SIMD_SAMPLES];
+	int status = EXIT_SUCCESS;
+	int exp;
+
+	for (long j = 0; j < SIMD_SAMPLES; ++j) {
+		t[j] = d * j / (SIMD_SAMPLES - 1);
+	}
+
+	frexpf(fabsf(b) + fabsf(c), &exp);
+
+	double ulp = ldexp(1.0, exp - FLT_MANT_DIG);
+
+	fprintf(fp, "SIMD kernel maximum errors against the batch functions (%ld samples, ulp of |b| + |c| = %g):\n",
+	            SIMD_SAMPLES, ulp);
+	fprintf(fp, "%-18s %-8s %12s %10s %10s %10s\n", "", "level", "abs error",
+	            "ulp", "bound", "differ");
+
+	if (EaseSimdDetect() < EASE_SIMD_SSE41) {
+		fprintf(fp, "No SIMD kernels on this CPU or target\n");
+	}
+
+	for (enum easing_types i = 0; i < NUM_PENNER_TYPES; ++i) {
+		EaseType type = (EaseType) i;
+		int fast_math = (i >= EASE_SINE_IN && i <= EASE_SINE_IN_OUT) ||
+		                (i >= EASE_EXPO_IN && i <= EASE_EXPO_IN_OUT) ||
+		                (i >= EASE_ELASTIC_IN && i <= EASE_ELASTIC_IN_OUT);
+		double bound = fast_math? SIMD_MAX_ULP : 0.0;
+
+		EaseSimdGetFunc(type, EASE_SIMD_SCALAR)(t, expected, SIMD_SAMPLES, b,
+		                                        c, d);
+
+		for (EaseSimdLevel level = EASE_SIMD_SSE41; level <= EaseSimdDetect();
+		     ++level)
+		{
+			double max_err = 0.0;
+			long differ = 0;
+
+			EaseSimdGetFunc(type, level)(t, out, SIMD_SAMPLES, b, c, d);
+
+			for (long j = 0; j < SIMD_SAMPLES; ++j) {
+				double err = fabs((double) out[j] - expected[j]);
+
+				// NOTE: A NaN must come out as a NaN, and compares as an error otherwise
+				if (memcmp(&out[j], &expected[j], sizeof(float)) != 0) {
+					differ++;
+
+					if (isnan(err)) {
+						err = INFINITY;
+					}
+				}
+
+				if (err > max_err) {
+					max_err = err;
+				}
+			}
+
+			int ok = (fast_math? max_err / ulp <= bound : differ == 0);
+
+			fprintf(fp, "%-18s %-8s %12.3e %10.3f %10.1f %10ld %s\n",
+			            easings[i].name, EaseSimdLevelName(level), max_err,
+			            max_err / ulp, bound, differ, ok? "OK" : "FAILED");
+
+			if (!ok) {
+				status = EXIT_FAILURE;
+			}
+		}
+	}
+
+	return status;
+}
+#endif
+
 static int get_float_arg(char *argvi, char *arg_prefix, float min, float max,
                          float *arg_var)
 {
@@ -379,7 +1168,7 @@ static int get_string_arg(char *argvi, char *arg_prefix, char *arg_array,
 	}
 
 	strncpy(arg_array, argvi + prefix_len, max_len - 1);
-	arg_array[max_len] = '\0';
+	arg_array[max_len - 1] = '\0';
 
 	return 0;
 }
\ No newline at end of file